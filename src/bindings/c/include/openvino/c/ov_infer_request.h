@@ -232,6 +232,21 @@ ov_infer_request_get_output_tensor_by_index(const ov_infer_request_t* infer_requ
 OPENVINO_C_API(ov_status_e)
 ov_infer_request_get_output_tensor(const ov_infer_request_t* infer_request, ov_tensor_t** tensor);
 
+/**
+ * @brief Set the outputs which are going to be read after the following inferences.
+ * @note It is a hint: the plugin may skip the computations which contribute only to the other outputs,
+ * so the values of the other output tensors are undefined.
+ * @ingroup ov_infer_request_c_api
+ * @param infer_request A pointer to the ov_infer_request_t.
+ * @param ports The list of const ports of the required outputs. An empty list means all the outputs are required.
+ * @param size The item count in the list.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_infer_request_set_required_outputs(ov_infer_request_t* infer_request,
+                                      const ov_output_const_port_t** ports,
+                                      const size_t size);
+
 /**
  * @brief Infer specified input(s) in synchronous mode.
  * @ingroup ov_infer_request_c_api
@@ -233,6 +233,29 @@ ov_status_e ov_infer_request_get_output_tensor(const ov_infer_request_t* infer_r
     return ov_status_e::OK;
 }
 
+ov_status_e ov_infer_request_set_required_outputs(ov_infer_request_t* infer_request,
+                                                  const ov_output_const_port_t** ports,
+                                                  const size_t size) {
+    if (!infer_request || (!ports && size > 0)) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        std::vector<ov::Output<const ov::Node>> required_outputs;
+        required_outputs.reserve(size);
+        for (size_t i = 0; i < size; i++) {
+            if (!ports[i]) {
+                return ov_status_e::INVALID_C_PARAM;
+            }
+            required_outputs.push_back(*ports[i]->object);
+        }
+        infer_request->object->set_required_outputs(required_outputs);
+    }
+    CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OK;
+}
+
 ov_status_e ov_infer_request_infer(ov_infer_request_t* infer_request) {
     if (!infer_request) {
         return ov_status_e::INVALID_C_PARAM;
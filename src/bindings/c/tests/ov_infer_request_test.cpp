@@ -298,6 +298,26 @@ TEST_P(ov_infer_request_test, infer) {
     ov_free(out_tensor_name);
 }
 
+TEST_P(ov_infer_request_test, set_required_outputs) {
+    ov_output_const_port_t* output_port = nullptr;
+    OV_EXPECT_OK(ov_compiled_model_output(compiled_model, &output_port));
+    EXPECT_NE(nullptr, output_port);
+
+    const ov_output_const_port_t* ports[] = {output_port};
+    OV_EXPECT_OK(ov_infer_request_set_required_outputs(infer_request, ports, 1));
+    OV_EXPECT_OK(ov_infer_request_set_tensor(infer_request, in_tensor_name, input_tensor));
+    OV_ASSERT_OK(ov_infer_request_infer(infer_request));
+
+    OV_EXPECT_OK(ov_infer_request_get_output_tensor(infer_request, &output_tensor));
+    EXPECT_NE(nullptr, output_tensor);
+
+    // an empty list means all the outputs are required
+    OV_EXPECT_OK(ov_infer_request_set_required_outputs(infer_request, nullptr, 0));
+    OV_EXPECT_NOT_OK(ov_infer_request_set_required_outputs(infer_request, nullptr, 1));
+
+    ov_output_const_port_free(output_port);
+}
+
 TEST_P(ov_infer_request_test, cancel) {
     OV_EXPECT_OK(ov_infer_request_set_tensor(infer_request, in_tensor_name, input_tensor));
     OV_ASSERT_OK(ov_infer_request_start_async(infer_request));
@@ -5,7 +5,7 @@
 import io
 from types import TracebackType
 from typing import Any, Union, Optional
-from collections.abc import Iterator
+from collections.abc import Iterable, Iterator
 from pathlib import Path
 import traceback  # noqa: F811
 
@@ -19,6 +19,7 @@ from openvino._pyopenvino import Node, Tensor, Type
 from openvino.utils.data_helpers import (
     OVDict,
     _InferRequestWrapper,
+    _RequestInputs,
     _data_dispatch,
     tensor_from_file,
 )
@@ -239,6 +240,61 @@ class InferRequest(_InferRequestWrapper):
             userdata,
         )
 
+    def infer_stream(self, chunks: Iterable[Any]) -> Iterator[OVDict]:
+        """Infers consecutive chunks of a long input, e.g. audio or text, in a streaming manner.
+
+        Intended for stateful models: the chunks are executed one by one on this request,
+        so the states are kept between the chunks without any `query_state` round trips.
+        While a chunk is running, the next chunk is taken from the iterable and converted
+        to tensors. The results of a chunk are returned to the caller once the next chunk
+        is started, so the request is busy while the caller handles them: the request must not
+        be used until the generator is exhausted or closed. Closing the generator waits for
+        the running chunk.
+
+        A `None` item ends the stream, the items after it are not taken from the iterable.
+
+        Every chunk is passed in one of the forms accepted by `infer`:
+        a dictionary with `int`, `str` or `openvino.ConstOutput` keys,
+        a list/tuple of inputs ordered as the model inputs, or a single
+        `numpy.ndarray`/`openvino.Tensor` for one-input models.
+
+        Input arrays are shared with the request when their data type and memory layout
+        allow it, so they must not be modified after they are taken from the iterable
+        until the results of their chunk are returned.
+
+        :param chunks: Iterable with the inputs of the consecutive chunks.
+        :type chunks: Iterable[Any]
+
+        :return: Generator of dictionaries with the results of each chunk, the data is always copied.
+        :rtype: Iterator[OVDict]
+        """
+        chunks = iter(chunks)
+        current = next(chunks, None)
+        if current is None:
+            return
+        # The chunks are converted without accessing the request, so the next chunk is converted
+        # while the current one is running
+        inputs = _RequestInputs(self)
+        current_tensors = _data_dispatch(inputs, current, is_shared=True)
+        # Inputs are shared, the request keeps the arrays of the running chunk alive
+        self._inputs_data = inputs._inputs_data
+        super().start_async(current_tensors, None)
+        try:
+            while current is not None:
+                following = next(chunks, None)
+                if following is not None:
+                    following_tensors = _data_dispatch(inputs, following, is_shared=True)
+                super().wait()
+                results = OVDict(super().results)
+                if following is not None:
+                    self._inputs_data = inputs._inputs_data
+                    super().start_async(following_tensors, None)
+                current = following
+                yield results
+        finally:
+            # The running chunk may still use the shared arrays when the stream is closed early
+            super().wait()
+
     def get_compiled_model(self) -> "CompiledModel":
         """Gets the compiled model this InferRequest is using.
 
@@ -1,6 +1,7 @@
 # type: ignore
 from __future__ import annotations
 from builtins import traceback as TracebackType
+from collections.abc import Iterable
 from collections.abc import Iterator
 from openvino._pyopenvino import AsyncInferQueue as AsyncInferQueueBase
 from openvino._pyopenvino import CompiledModel as CompiledModelBase
@@ -10,6 +11,7 @@ from openvino._pyopenvino import Node
 from openvino._pyopenvino import Tensor
 from openvino._pyopenvino import Type
 from openvino.package_utils import deprecatedclassproperty
+from openvino.utils.data_helpers.data_dispatcher import _RequestInputs
 from openvino.utils.data_helpers.data_dispatcher import _data_dispatch
 from openvino.utils.data_helpers.wrappers import OVDict
 from openvino.utils.data_helpers.wrappers import _InferRequestWrapper
@@ -24,7 +26,7 @@ import openvino.utils.data_helpers.wrappers
 import pathlib
 import traceback as traceback
 import typing
-__all__ = ['AsyncInferQueue', 'AsyncInferQueueBase', 'CompiledModel', 'CompiledModelBase', 'Core', 'CoreBase', 'InferRequest', 'Iterator', 'Model', 'ModelBase', 'ModelMeta', 'Node', 'OVDict', 'Path', 'Tensor', 'TracebackType', 'Type', 'compile_model', 'deprecatedclassproperty', 'io', 'tensor_from_file', 'traceback']
+__all__ = ['AsyncInferQueue', 'AsyncInferQueueBase', 'CompiledModel', 'CompiledModelBase', 'Core', 'CoreBase', 'InferRequest', 'Iterable', 'Iterator', 'Model', 'ModelBase', 'ModelMeta', 'Node', 'OVDict', 'Path', 'Tensor', 'TracebackType', 'Type', 'compile_model', 'deprecatedclassproperty', 'io', 'tensor_from_file', 'traceback']
 class AsyncInferQueue(openvino._pyopenvino.AsyncInferQueue):
     """
     AsyncInferQueue with a pool of asynchronous requests.
@@ -423,6 +425,36 @@ class InferRequest(openvino.utils.data_helpers.wrappers._InferRequestWrapper):
                 :return: Dictionary of results from output tensors with port/int/str keys.
                 :rtype: OVDict
                 
+        """
+    def infer_stream(self, chunks: collections.abc.Iterable[typing.Any]) -> collections.abc.Iterator[openvino.utils.data_helpers.wrappers.OVDict]:
+        """
+        Infers consecutive chunks of a long input, e.g. audio or text, in a streaming manner.
+        
+                Intended for stateful models: the chunks are executed one by one on this request,
+                so the states are kept between the chunks without any `query_state` round trips.
+                While a chunk is running, the next chunk is taken from the iterable and converted
+                to tensors. The results of a chunk are returned to the caller once the next chunk
+                is started, so the request is busy while the caller handles them: the request must not
+                be used until the generator is exhausted or closed. Closing the generator waits for
+                the running chunk.
+        
+                A `None` item ends the stream, the items after it are not taken from the iterable.
+        
+                Every chunk is passed in one of the forms accepted by `infer`:
+                a dictionary with `int`, `str` or `openvino.ConstOutput` keys,
+                a list/tuple of inputs ordered as the model inputs, or a single
+                `numpy.ndarray`/`openvino.Tensor` for one-input models.
+        
+                Input arrays are shared with the request when their data type and memory layout
+                allow it, so they must not be modified after they are taken from the iterable
+                until the results of their chunk are returned.
+        
+                :param chunks: Iterable with the inputs of the consecutive chunks.
+                :type chunks: Iterable[Any]
+        
+                :return: Generator of dictionaries with the results of each chunk, the data is always copied.
+                :rtype: Iterator[OVDict]
+                
         """
     def start_async(self, inputs: typing.Any = None, userdata: typing.Any = None, share_inputs: bool = False) -> None:
         """
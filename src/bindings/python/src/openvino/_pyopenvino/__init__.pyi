@@ -67,7 +67,7 @@ class AsyncInferQueue:
                     :return: If there is at least one free InferRequest in a pool, returns True.
                     :rtype: bool
         """
-    def set_callback(self, arg0: typing.Callable) -> None:
+    def set_callback(self, callback: typing.Callable, batch_dispatch: bool = False) -> None:
         """
                     Sets unified callback on all InferRequests from queue's pool.
                     Signature of such function should have two arguments, where
@@ -84,6 +84,11 @@ class AsyncInferQueue:
         
                     :param callback: Any Python defined function that matches callback's requirements.
                     :type callback: function
+                    :param batch_dispatch: If True, callbacks are not run by the finishing requests.
+                    Instead, a single dispatcher thread collects finished requests and runs their callbacks
+                    in bulk under one GIL acquisition. A request becomes idle once its callback is done.
+                    Recommended for high request rates of small models. Default: False
+                    :type batch_dispatch: bool
         """
     @typing.overload
     def start_async(self, inputs: Tensor, userdata: typing.Any) -> None:
@@ -1720,6 +1725,17 @@ class InferRequest:
                     :param outputs: Data to set on output tensors.
                     :type outputs: dict[int, openvino.Tensor]
         """
+    def set_required_outputs(self, ports: list[ConstOutput]) -> None:
+        """
+                    Sets the outputs which are going to be read after the following inferences.
+        
+                    It is a hint: the plugin may skip the computations which contribute only
+                    to the other outputs, so the values of the other output tensors are undefined.
+        
+                    :param ports: Ports of the required outputs. An empty list means
+                                  that all the outputs are required.
+                    :type ports: list[openvino.ConstOutput]
+        """
     @typing.overload
     def set_tensor(self, name: str, tensor: RemoteTensor) -> None:
         """
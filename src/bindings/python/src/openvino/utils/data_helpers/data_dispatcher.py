@@ -13,6 +13,8 @@ from openvino.utils.data_helpers.wrappers import _InferRequestWrapper, OVDict
 ContainerTypes = Union[dict, list, tuple, OVDict]
 ScalarTypes = Union[np.number, int, float]
 ValidKeys = Union[str, int, ConstOutput]
+# The inputs may be converted without accessing the request, see _RequestInputs
+RequestTypes = Union[_InferRequestWrapper, "_RequestInputs"]
 
 
 def is_list_simple_type(input_list: list) -> bool:
@@ -28,7 +30,7 @@ def is_list_simple_type(input_list: list) -> bool:
 
 
 def get_request_tensor(
-    request: _InferRequestWrapper,
+    request: RequestTypes,
     key: Optional[ValidKeys] = None,
 ) -> Tensor:
     if key is None:
@@ -44,7 +46,7 @@ def get_request_tensor(
 @singledispatch
 def value_to_tensor(
     value: Union[Tensor, np.ndarray, ScalarTypes, str],
-    request: Optional[_InferRequestWrapper] = None,
+    request: Optional[RequestTypes] = None,
     is_shared: bool = False,
     key: Optional[ValidKeys] = None,
 ) -> None:
@@ -54,7 +56,7 @@ def value_to_tensor(
 @value_to_tensor.register(Tensor)
 def _(
     value: Tensor,
-    request: Optional[_InferRequestWrapper] = None,
+    request: Optional[RequestTypes] = None,
     is_shared: bool = False,
     key: Optional[ValidKeys] = None,
 ) -> Tensor:
@@ -64,7 +66,7 @@ def _(
 @value_to_tensor.register(RemoteTensor)
 def _(
     value: RemoteTensor,
-    request: Optional[_InferRequestWrapper] = None,
+    request: Optional[RequestTypes] = None,
     is_shared: bool = False,
     key: Optional[ValidKeys] = None,
 ) -> RemoteTensor:
@@ -74,7 +76,7 @@ def _(
 @value_to_tensor.register(np.ndarray)
 def _(
     value: np.ndarray,
-    request: _InferRequestWrapper,
+    request: RequestTypes,
     is_shared: bool = False,
     key: Optional[ValidKeys] = None,
 ) -> Tensor:
@@ -115,7 +117,7 @@ def _(
 @value_to_tensor.register(list)
 def _(
     value: list,
-    request: _InferRequestWrapper,
+    request: RequestTypes,
     is_shared: bool = False,
     key: Optional[ValidKeys] = None,
 ) -> Tensor:
@@ -129,7 +131,7 @@ def _(
 @value_to_tensor.register(bytes)
 def _(
     value: Union[ScalarTypes, str, bytes],
-    request: _InferRequestWrapper,
+    request: RequestTypes,
     is_shared: bool = False,
     key: Optional[ValidKeys] = None,
 ) -> Tensor:
@@ -220,7 +222,7 @@ def _(
 @singledispatch
 def create_shared(
     inputs: Any,
-    request: _InferRequestWrapper,
+    request: RequestTypes,
 ) -> None:
     # Check the special case of the array-interface
     if hasattr(inputs, "__array__"):
@@ -235,7 +237,7 @@ def create_shared(
 @create_shared.register(OVDict)
 def _(
     inputs: Union[dict, tuple, OVDict],
-    request: _InferRequestWrapper,
+    request: RequestTypes,
 ) -> dict:
     request._inputs_data = normalize_arrays(inputs, is_shared=True)
     return {k: value_to_tensor(v, request=request, is_shared=True, key=k) for k, v in request._inputs_data.items()}
@@ -245,7 +247,7 @@ def _(
 @create_shared.register(list)
 def _(
     inputs: list,
-    request: _InferRequestWrapper,
+    request: RequestTypes,
 ) -> dict:
     # If list is passed to single input model and consists only of simple types
     # i.e. str/bytes/float/int, wrap around it and pass into the dispatcher.
@@ -256,7 +258,7 @@ def _(
 @create_shared.register(np.ndarray)
 def _(
     inputs: np.ndarray,
-    request: _InferRequestWrapper,
+    request: RequestTypes,
 ) -> Tensor:
     request._inputs_data = normalize_arrays(inputs, is_shared=True)
     return value_to_tensor(request._inputs_data, request=request, is_shared=True)
@@ -270,7 +272,7 @@ def _(
 @create_shared.register(bytes)
 def _(
     inputs: Union[Tensor, ScalarTypes, str, bytes],
-    request: _InferRequestWrapper,
+    request: RequestTypes,
 ) -> Tensor:
     return value_to_tensor(inputs, request=request, is_shared=True)
 ###
@@ -282,7 +284,7 @@ def _(
 # Start of "copied" dispatcher.
 ###
 def set_request_tensor(
-    request: _InferRequestWrapper,
+    request: RequestTypes,
     tensor: Tensor,
     key: Optional[ValidKeys] = None,
 ) -> None:
@@ -299,7 +301,7 @@ def set_request_tensor(
 @singledispatch
 def update_tensor(
     inputs: Any,
-    request: _InferRequestWrapper,
+    request: RequestTypes,
     key: Optional[ValidKeys] = None,
 ) -> None:
     if hasattr(inputs, "__array__"):
@@ -311,7 +313,7 @@ def update_tensor(
 @update_tensor.register(np.ndarray)
 def _(
     inputs: np.ndarray,
-    request: _InferRequestWrapper,
+    request: RequestTypes,
     key: Optional[ValidKeys] = None,
 ) -> None:
     if inputs.ndim != 0:
@@ -339,7 +341,7 @@ def _(
 @update_tensor.register(str)
 def _(
     inputs: Union[ScalarTypes, str],
-    request: _InferRequestWrapper,
+    request: RequestTypes,
     key: Optional[ValidKeys] = None,
 ) -> None:
     set_request_tensor(
@@ -349,7 +351,7 @@ def _(
     )
 
 
-def update_inputs(inputs: dict, request: _InferRequestWrapper) -> dict:
+def update_inputs(inputs: dict, request: RequestTypes) -> dict:
     """Helper function to prepare inputs for inference.
 
     It creates copy of Tensors or copy data to already allocated Tensors on device
@@ -381,7 +383,7 @@ def update_inputs(inputs: dict, request: _InferRequestWrapper) -> dict:
 @singledispatch
 def create_copied(
     inputs: Union[ContainerTypes, np.ndarray, ScalarTypes, str, bytes],
-    request: _InferRequestWrapper,
+    request: RequestTypes,
 ) -> Union[dict, None]:
     # Check the special case of the array-interface
     if hasattr(inputs, "__array__"):
@@ -396,7 +398,7 @@ def create_copied(
 @create_copied.register(OVDict)
 def _(
     inputs: Union[dict, tuple, OVDict],
-    request: _InferRequestWrapper,
+    request: RequestTypes,
 ) -> dict:
     return update_inputs(normalize_arrays(inputs, is_shared=False), request)
 
@@ -405,7 +407,7 @@ def _(
 @create_copied.register(list)
 def _(
     inputs: list,
-    request: _InferRequestWrapper,
+    request: RequestTypes,
 ) -> dict:
     # If list is passed to single input model and consists only of simple types
     # i.e. str/bytes/float/int, wrap around it and pass into the dispatcher.
@@ -415,7 +417,7 @@ def _(
 @create_copied.register(np.ndarray)
 def _(
     inputs: np.ndarray,
-    request: _InferRequestWrapper,
+    request: RequestTypes,
 ) -> dict:
     update_tensor(normalize_arrays(inputs, is_shared=False), request, key=None)
     return {}
@@ -429,7 +431,7 @@ def _(
 @create_copied.register(bytes)
 def _(
     inputs: Union[Tensor, ScalarTypes, str, bytes],
-    request: _InferRequestWrapper,
+    request: RequestTypes,
 ) -> Tensor:
     return value_to_tensor(inputs, request=request, is_shared=False)
 ###
@@ -437,8 +439,39 @@ def _(
 ###
 
 
+class _RequestInputs:
+    """Input tensors of an infer request, used to convert the inputs while the request is busy.
+
+    The tensor of each key is taken from the request once, when the key is met for the first time,
+    so the following inputs with the same keys are converted without accessing the running request.
+    """
+
+    def __init__(self, request: _InferRequestWrapper) -> None:
+        self._request = request
+        self._single_input = request._is_single_input()
+        self._tensors: dict[Optional[ValidKeys], Tensor] = {}
+        # Private member to store newly created shared memory data
+        self._inputs_data = None
+
+    def _is_single_input(self) -> bool:
+        return self._single_input
+
+    def _get(self, key: Optional[ValidKeys]) -> Tensor:
+        if key not in self._tensors:
+            # The request cannot be accessed while it is busy
+            self._request.wait()
+            self._tensors[key] = get_request_tensor(self._request, key)
+        return self._tensors[key]
+
+    def get_input_tensor(self, key: Optional[int] = None) -> Tensor:
+        return self._get(key)
+
+    def get_tensor(self, key: Union[str, ConstOutput]) -> Tensor:
+        return self._get(key)
+
+
 def _data_dispatch(
-    request: _InferRequestWrapper,
+    request: RequestTypes,
     inputs: Union[ContainerTypes, Tensor, np.ndarray, ScalarTypes, str] = None,
     is_shared: bool = False,
 ) -> Union[dict, Tensor]:
@@ -11,26 +11,44 @@ import numpy as np
 import openvino._pyopenvino
 import openvino.utils.data_helpers.wrappers
 import typing
-__all__ = ['ConstOutput', 'ContainerTypes', 'OVDict', 'RemoteTensor', 'ScalarTypes', 'Tensor', 'Type', 'ValidKeys', 'create_copied', 'create_shared', 'get_request_tensor', 'is_list_simple_type', 'normalize_arrays', 'np', 'set_request_tensor', 'singledispatch', 'to_c_style', 'update_inputs', 'update_tensor', 'value_to_tensor']
-def _(inputs: typing.Union[openvino._pyopenvino.Tensor, numpy.number, int, float, str, bytes], request: openvino.utils.data_helpers.wrappers._InferRequestWrapper) -> openvino._pyopenvino.Tensor:
+__all__ = ['ConstOutput', 'ContainerTypes', 'OVDict', 'RemoteTensor', 'RequestTypes', 'ScalarTypes', 'Tensor', 'Type', 'ValidKeys', 'create_copied', 'create_shared', 'get_request_tensor', 'is_list_simple_type', 'normalize_arrays', 'np', 'set_request_tensor', 'singledispatch', 'to_c_style', 'update_inputs', 'update_tensor', 'value_to_tensor']
+class _RequestInputs:
+    """
+    Input tensors of an infer request, used to convert the inputs while the request is busy.
+    
+        The tensor of each key is taken from the request once, when the key is met for the first time,
+        so the following inputs with the same keys are converted without accessing the running request.
+        
+    """
+    def __init__(self, request: openvino.utils.data_helpers.wrappers._InferRequestWrapper) -> None:
+        ...
+    def _get(self, key: typing.Union[str, int, openvino._pyopenvino.ConstOutput, NoneType]) -> openvino._pyopenvino.Tensor:
+        ...
+    def _is_single_input(self) -> bool:
+        ...
+    def get_input_tensor(self, key: typing.Optional[int] = None) -> openvino._pyopenvino.Tensor:
+        ...
+    def get_tensor(self, key: typing.Union[str, openvino._pyopenvino.ConstOutput]) -> openvino._pyopenvino.Tensor:
+        ...
+def _(inputs: typing.Union[openvino._pyopenvino.Tensor, numpy.number, int, float, str, bytes], request: typing.Union[openvino.utils.data_helpers.wrappers._InferRequestWrapper, openvino.utils.data_helpers.data_dispatcher._RequestInputs]) -> openvino._pyopenvino.Tensor:
     ...
-def _data_dispatch(request: openvino.utils.data_helpers.wrappers._InferRequestWrapper, inputs: typing.Union[dict, list, tuple, openvino.utils.data_helpers.wrappers.OVDict, openvino._pyopenvino.Tensor, numpy.ndarray, numpy.number, int, float, str] = None, is_shared: bool = False) -> typing.Union[dict, openvino._pyopenvino.Tensor]:
+def _data_dispatch(request: typing.Union[openvino.utils.data_helpers.wrappers._InferRequestWrapper, openvino.utils.data_helpers.data_dispatcher._RequestInputs], inputs: typing.Union[dict, list, tuple, openvino.utils.data_helpers.wrappers.OVDict, openvino._pyopenvino.Tensor, numpy.ndarray, numpy.number, int, float, str] = None, is_shared: bool = False) -> typing.Union[dict, openvino._pyopenvino.Tensor]:
     ...
 def create_copied(*args, **kw) -> typing.Optional[dict]:
     ...
 def create_shared(*args, **kw) -> None:
     ...
-def get_request_tensor(request: openvino.utils.data_helpers.wrappers._InferRequestWrapper, key: typing.Union[str, int, openvino._pyopenvino.ConstOutput, NoneType] = None) -> openvino._pyopenvino.Tensor:
+def get_request_tensor(request: typing.Union[openvino.utils.data_helpers.wrappers._InferRequestWrapper, openvino.utils.data_helpers.data_dispatcher._RequestInputs], key: typing.Union[str, int, openvino._pyopenvino.ConstOutput, NoneType] = None) -> openvino._pyopenvino.Tensor:
     ...
 def is_list_simple_type(input_list: list) -> bool:
     ...
 def normalize_arrays(*args, **kw) -> typing.Any:
     ...
-def set_request_tensor(request: openvino.utils.data_helpers.wrappers._InferRequestWrapper, tensor: openvino._pyopenvino.Tensor, key: typing.Union[str, int, openvino._pyopenvino.ConstOutput, NoneType] = None) -> None:
+def set_request_tensor(request: typing.Union[openvino.utils.data_helpers.wrappers._InferRequestWrapper, openvino.utils.data_helpers.data_dispatcher._RequestInputs], tensor: openvino._pyopenvino.Tensor, key: typing.Union[str, int, openvino._pyopenvino.ConstOutput, NoneType] = None) -> None:
     ...
 def to_c_style(value: typing.Any, is_shared: bool = False) -> typing.Any:
     ...
-def update_inputs(inputs: dict, request: openvino.utils.data_helpers.wrappers._InferRequestWrapper) -> dict:
+def update_inputs(inputs: dict, request: typing.Union[openvino.utils.data_helpers.wrappers._InferRequestWrapper, openvino.utils.data_helpers.data_dispatcher._RequestInputs]) -> dict:
     """
     Helper function to prepare inputs for inference.
     
@@ -44,5 +62,6 @@ def update_tensor(*args, **kw) -> None:
 def value_to_tensor(*args, **kw) -> None:
     ...
 ContainerTypes: typing._UnionGenericAlias  # value = typing.Union[dict, list, tuple, openvino.utils.data_helpers.wrappers.OVDict]
+RequestTypes: typing._UnionGenericAlias  # value = typing.Union[openvino.utils.data_helpers.wrappers._InferRequestWrapper, ForwardRef('_RequestInputs')]
 ScalarTypes: typing._UnionGenericAlias  # value = typing.Union[numpy.number, int, float]
 ValidKeys: typing._UnionGenericAlias  # value = typing.Union[str, int, openvino._pyopenvino.ConstOutput]
@@ -11,6 +11,7 @@
 #include <mutex>
 #include <queue>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "pyopenvino/core/common.hpp"
@@ -41,6 +42,7 @@ public:
     }
 
     ~AsyncInferQueue() {
+        stop_dispatcher();
         m_requests.clear();
     }
 
@@ -78,8 +80,12 @@ public:
         for (auto&& request : m_requests) {
             request.m_request->wait();
         }
-        // acquire the mutex to access m_errors
-        std::lock_guard<std::mutex> lock(m_mutex);
+        // acquire the mutex to access m_errors and m_pending_dispatch
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // in batch dispatch mode callbacks of finished requests may still wait for the dispatcher
+        m_cv.wait(lock, [this] {
+            return m_pending_dispatch == 0;
+        });
         if (m_errors.size() > 0)
             throw m_errors.front();
     }
@@ -110,10 +116,16 @@ public:
         }
     }
 
-    void set_custom_callbacks(py::function f_callback) {
+    void set_custom_callbacks(py::function f_callback, bool batch_dispatch) {
         // need to acquire GIL before py::function deletion
         auto callback_sp = Common::utils::wrap_pyfunction(std::move(f_callback));
 
+        if (batch_dispatch) {
+            set_batch_dispatch_callbacks(callback_sp);
+            return;
+        }
+        stop_dispatcher();
+
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
             m_requests[handle].m_request->set_callback([this, callback_sp, handle](std::exception_ptr exception_ptr) {
                 *m_requests[handle].m_end_time = Time::now();
@@ -154,6 +166,133 @@ public:
         }
     }
 
+    void set_batch_dispatch_callbacks(const std::shared_ptr<py::function>& callback_sp) {
+        {
+            std::lock_guard<std::mutex> lock(m_dispatch_mutex);
+            m_dispatch_callback = callback_sp;
+        }
+        if (!m_dispatcher.joinable()) {
+            m_dispatch_stop = false;
+            m_dispatcher = std::thread(&AsyncInferQueue::dispatch_completions, this);
+        }
+
+        for (size_t handle = 0; handle < m_requests.size(); handle++) {
+            m_requests[handle].m_request->set_callback([this, handle](std::exception_ptr exception_ptr) {
+                *m_requests[handle].m_end_time = Time::now();
+                if (exception_ptr == nullptr) {
+                    {
+                        // acquire the mutex to access m_pending_dispatch
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        m_pending_dispatch++;
+                    }
+                    {
+                        // the handle becomes idle only after the dispatcher runs the Python callback for it
+                        std::lock_guard<std::mutex> lock(m_dispatch_mutex);
+                        m_completed_handles.push_back(handle);
+                    }
+                    m_dispatch_cv.notify_one();
+                    return;
+                }
+
+                {
+                    // acquire the mutex to access m_idle_handles
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    // Add idle handle to queue
+                    m_idle_handles.push(handle);
+                }
+                // Notify locks in getIdleRequestId()
+                m_cv.notify_one();
+
+                try {
+                    std::rethrow_exception(exception_ptr);
+                } catch (const std::exception& e) {
+                    OPENVINO_THROW(e.what());
+                }
+            });
+        }
+    }
+
+    void dispatch_completions() {
+        std::vector<size_t> completed;
+        std::shared_ptr<py::function> callback;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(m_dispatch_mutex);
+                m_dispatch_cv.wait(lock, [this] {
+                    return m_dispatch_stop || !m_completed_handles.empty();
+                });
+                if (m_completed_handles.empty()) {
+                    return;
+                }
+                completed.swap(m_completed_handles);
+                callback = m_dispatch_callback;
+            }
+            {
+                // Run callbacks of all requests completed so far under a single GIL acquisition
+                py::gil_scoped_acquire acquire;
+                for (auto handle : completed) {
+                    try {
+                        (*callback)(m_requests[handle], m_user_ids[handle]);
+                    } catch (const py::error_already_set& py_error) {
+                        assert(py_error.type());
+                        // acquire the mutex to access m_errors
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        m_errors.push(py_error);
+                    } catch (const std::exception& e) {
+                        push_dispatch_error(e.what());
+                    } catch (...) {
+                        push_dispatch_error("Unknown exception in the callback of AsyncInferQueue");
+                    }
+                }
+            }
+            {
+                // acquire the mutex to access m_idle_handles and m_pending_dispatch
+                std::lock_guard<std::mutex> lock(m_mutex);
+                for (auto handle : completed) {
+                    m_idle_handles.push(handle);
+                }
+                m_pending_dispatch -= completed.size();
+            }
+            // Notify locks in getIdleRequestId() and wait_all()
+            m_cv.notify_all();
+            completed.clear();
+        }
+    }
+
+    // Stores a C++ error of the dispatched callback as a Python one, so wait_all() reports it like the others.
+    // Errors must not leave the dispatcher, otherwise the handles never become idle and wait_all() hangs.
+    void push_dispatch_error(const char* message) {
+        PyErr_SetString(PyExc_RuntimeError, message);
+        py::error_already_set py_error;
+        // acquire the mutex to access m_errors
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_errors.push(py_error);
+    }
+
+    void stop_dispatcher() {
+        if (!m_dispatcher.joinable()) {
+            return;
+        }
+        {
+            // release GIL to let the dispatcher run callbacks of the requests which are finishing
+            py::gil_scoped_release release;
+            for (auto&& request : m_requests) {
+                try {
+                    request.m_request->wait();
+                } catch (...) {
+                    // errors of inference are reported by wait_all(), here requests are only drained
+                }
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_dispatch_mutex);
+                m_dispatch_stop = true;
+            }
+            m_dispatch_cv.notify_one();
+            m_dispatcher.join();
+        }
+        m_dispatch_callback.reset();
+    }
+
     // AsyncInferQueue is the owner of all requests. When AsyncInferQueue is destroyed,
     // all of requests are destroyed as well.
     std::vector<InferRequestWrapper> m_requests;
@@ -162,6 +301,16 @@ public:
     std::mutex m_mutex;
     std::condition_variable m_cv;
     std::queue<py::error_already_set> m_errors;
+    // number of finished requests whose callbacks are not yet run by the dispatcher, guarded by m_mutex
+    size_t m_pending_dispatch = 0;
+
+    // batch dispatch mode: finished requests are collected here and their callbacks are run by one thread
+    std::thread m_dispatcher;
+    std::mutex m_dispatch_mutex;
+    std::condition_variable m_dispatch_cv;
+    std::vector<size_t> m_completed_handles;
+    std::shared_ptr<py::function> m_dispatch_callback;
+    bool m_dispatch_stop = false;
 };
 
 void regclass_AsyncInferQueue(py::module m) {
@@ -303,6 +452,8 @@ void regclass_AsyncInferQueue(py::module m) {
 
     cls.def("set_callback",
             &AsyncInferQueue::set_custom_callbacks,
+            py::arg("callback"),
+            py::arg("batch_dispatch") = false,
             R"(
             Sets unified callback on all InferRequests from queue's pool.
             Signature of such function should have two arguments, where
@@ -319,6 +470,11 @@ void regclass_AsyncInferQueue(py::module m) {
 
             :param callback: Any Python defined function that matches callback's requirements.
             :type callback: function
+            :param batch_dispatch: If True, callbacks are not run by the finishing requests.
+            Instead, a single dispatcher thread collects finished requests and runs their callbacks
+            in bulk under one GIL acquisition. A request becomes idle once its callback is done.
+            Recommended for high request rates of small models. Default: False
+            :type batch_dispatch: bool
         )");
 
     cls.def(
@@ -636,6 +636,23 @@ void regclass_InferRequest(py::module m) {
             :rtype: list[openvino.VariableState]
         )");
 
+    cls.def(
+        "set_required_outputs",
+        [](InferRequestWrapper& self, const std::vector<ov::Output<const ov::Node>>& ports) {
+            self.m_request->set_required_outputs(ports);
+        },
+        py::arg("ports"),
+        R"(
+            Sets the outputs which are going to be read after the following inferences.
+
+            It is a hint: the plugin may skip the computations which contribute only
+            to the other outputs, so the values of the other output tensors are undefined.
+
+            :param ports: Ports of the required outputs. An empty list means
+                          that all the outputs are required.
+            :type ports: list[openvino.ConstOutput]
+        )");
+
     cls.def(
         "reset_state",
         [](InferRequestWrapper& self) {
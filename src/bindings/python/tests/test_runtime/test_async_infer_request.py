@@ -57,6 +57,51 @@ def test_infer_queue(device, share_inputs):
     assert all(job["latency"] > 0 for job in jobs_done)
 
 
+@pytest.mark.parametrize("num_request", [1, 4])
+def test_infer_queue_batch_dispatch(device, num_request):
+    jobs = 32
+    core = Core()
+    model = get_relu_model()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, num_request)
+    jobs_done = [{"finished": False, "latency": 0} for _ in range(jobs)]
+
+    def callback(request, job_id):
+        jobs_done[job_id]["finished"] = True
+        jobs_done[job_id]["latency"] = request.latency
+
+    img = generate_image()
+    infer_queue.set_callback(callback, batch_dispatch=True)
+    assert infer_queue.is_ready()
+
+    for i in range(jobs):
+        infer_queue.start_async({"data": img}, i)
+    infer_queue.wait_all()
+    assert all(job["finished"] for job in jobs_done)
+    assert all(job["latency"] > 0 for job in jobs_done)
+    assert infer_queue.is_ready()
+
+
+def test_infer_queue_batch_dispatch_fail_on_py_model(device):
+    core = Core()
+    model = get_relu_model()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 2)
+
+    def callback(request, _):
+        request = request + 21
+
+    img = generate_image()
+    infer_queue.set_callback(callback, batch_dispatch=True)
+
+    with pytest.raises(TypeError) as e:
+        for _ in range(4):
+            infer_queue.start_async({"data": img})
+        infer_queue.wait_all()
+
+    assert "unsupported operand type(s) for +" in str(e.value)
+
+
 def test_infer_queue_iteration(device):
     core = Core()
     param = ops.parameter([10])
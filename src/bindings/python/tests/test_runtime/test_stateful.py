@@ -94,3 +94,91 @@ def test_query_state_write_buffer(device, base_class, input_shape, data_type, mo
             expected_res = np.full(input_shape, i, dtype=data_type)
 
         assert np.allclose(res[list(res)[0]], expected_res, atol=1e-6), f"Expected values: {expected_res} \n Actual values: {res} \n"
+
+
+@pytest.mark.parametrize("chunk_type", ["array", "list", "dict", "tensor"])
+@pytest.mark.skipif(
+    os.environ.get("TEST_DEVICE", "CPU") not in ["CPU", "GPU"],
+    reason=f"Can't run test on device {os.environ.get('TEST_DEVICE', 'CPU')}, "
+    "Memory layers fully supported only on CPU and GPU",
+)
+def test_infer_stream(device, chunk_type):
+    core = Core()
+    input_shape = [2, 10]
+
+    model = generate_model_with_memory(input_shape, np.float32)
+    compiled_model = core.compile_model(model=model, device_name=device)
+    request = compiled_model.create_infer_request()
+
+    def make_chunk(value):
+        # int data is converted to the model's input type
+        data = np.full(input_shape, value, dtype=np.int32)
+        if chunk_type == "list":
+            return [data]
+        if chunk_type == "dict":
+            return {0: data}
+        if chunk_type == "tensor":
+            return Tensor(data.astype(np.float32))
+        return data
+
+    chunks = [make_chunk(i) for i in range(1, 6)]
+    expected = 0
+    results = []
+    for i, res in enumerate(request.infer_stream(chunks)):
+        expected += i + 1
+        results.append(res)
+        assert np.allclose(res[0], np.full(input_shape, expected))
+    assert len(results) == len(chunks)
+    # the returned data is not overwritten by the following chunks
+    assert np.allclose(results[0][0], np.full(input_shape, 1))
+
+    # the state is kept in the request after the stream
+    res = request.infer({0: np.zeros(input_shape, dtype=np.float32)})
+    assert np.allclose(res[0], np.full(input_shape, expected))
+
+
+@pytest.mark.skipif(
+    os.environ.get("TEST_DEVICE", "CPU") not in ["CPU", "GPU"],
+    reason=f"Can't run test on device {os.environ.get('TEST_DEVICE', 'CPU')}, "
+    "Memory layers fully supported only on CPU and GPU",
+)
+def test_infer_stream_closed_early(device):
+    core = Core()
+    input_shape = [10]
+
+    model = generate_model_with_memory(input_shape, np.float32)
+    compiled_model = core.compile_model(model=model, device_name=device)
+    request = compiled_model.create_infer_request()
+
+    chunks = (np.ones(input_shape, dtype=np.float32) for _ in range(10))
+    stream = request.infer_stream(chunks)
+    res = next(stream)
+    assert np.allclose(res[0], np.full(input_shape, 1))
+    # the second chunk has been already started, closing the stream waits for it
+    stream.close()
+
+    res = request.infer({0: np.zeros(input_shape, dtype=np.float32)})
+    assert np.allclose(res[0], np.full(input_shape, 2))
+
+    assert list(request.infer_stream([])) == []
+
+
+@pytest.mark.skipif(
+    os.environ.get("TEST_DEVICE", "CPU") not in ["CPU", "GPU"],
+    reason=f"Can't run test on device {os.environ.get('TEST_DEVICE', 'CPU')}, "
+    "Memory layers fully supported only on CPU and GPU",
+)
+def test_infer_stream_none_ends_stream(device):
+    core = Core()
+    input_shape = [10]
+
+    model = generate_model_with_memory(input_shape, np.float32)
+    compiled_model = core.compile_model(model=model, device_name=device)
+    request = compiled_model.create_infer_request()
+
+    chunks = iter([np.ones(input_shape, dtype=np.float32), None, np.ones(input_shape, dtype=np.float32)])
+    results = list(request.infer_stream(chunks))
+    assert len(results) == 1
+    assert np.allclose(results[0][0], np.full(input_shape, 1))
+    # the chunk after None is left in the iterable
+    assert next(chunks, None) is not None
@@ -366,6 +366,25 @@ def test_get_results(device, share_inputs):
         assert np.array_equal(results[output], request.results[output])
 
 
+def test_set_required_outputs(device):
+    core = Core()
+    param = ops.parameter([10], np.float32)
+    model = Model([ops.relu(param), ops.negative(param)], [param])
+    compiled_model = core.compile_model(model, device)
+    request = compiled_model.create_infer_request()
+    data = np.random.normal(size=[10]).astype(np.float32)
+
+    request.set_required_outputs([compiled_model.output(0)])
+    results = request.infer([data])
+    assert np.allclose(results[compiled_model.output(0)], np.maximum(data, 0))
+
+    # an empty list means all the outputs are required
+    request.set_required_outputs([])
+    results = request.infer([data])
+    assert np.allclose(results[compiled_model.output(0)], np.maximum(data, 0))
+    assert np.allclose(results[compiled_model.output(1)], -data)
+
+
 @pytest.mark.skipif(
     os.environ.get("TEST_DEVICE") not in ["GPU"],
     reason="Device dependent test",
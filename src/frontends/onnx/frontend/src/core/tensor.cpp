@@ -302,6 +302,13 @@ std::shared_ptr<ov::op::v0::Constant> Tensor::get_ov_constant() const {
                 "The size of the external data file does not match the byte size of an initializer '" + get_name() +
                 "' in the model");
         }
+    } else if (element_count == shape_size(m_shape) && m_tensor_proto->has_raw_data()) {
+        if (m_tensor_proto->data_type() == TensorProto_DataType::TensorProto_DataType_STRING) {
+            FRONT_END_THROW("Loading strings from raw data isn't supported");
+        }
+        // raw_data is already laid out the same way as OV keeps the data of the given type,
+        // so the Constant may copy it directly without an intermediate typed vector
+        constant = std::make_shared<ov::op::v0::Constant>(ov_type, m_shape, get_data_ptr());
     } else if (element_count == shape_size(m_shape)) {
         switch (m_tensor_proto->data_type()) {
         case TensorProto_DataType::TensorProto_DataType_FLOAT:
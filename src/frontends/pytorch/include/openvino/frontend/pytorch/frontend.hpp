@@ -67,6 +67,11 @@ protected:
     std::map<std::string, CreatorFunction> m_op_extension_translators;
     std::vector<ConversionExtensionBase::Ptr> m_conversion_extensions;
     TelemetryExtension::Ptr m_telemetry;
+
+private:
+    class SupportedOpsCache;
+    // translators merged with op extensions per decoder type, reset when a new op extension is added
+    std::shared_ptr<SupportedOpsCache> m_supported_ops_cache;
 };
 
 }  // namespace pytorch
@@ -4,6 +4,8 @@
 
 #include "openvino/frontend/pytorch/frontend.hpp"
 
+#include <mutex>
+
 #include "input_model.hpp"
 #include "op_table.hpp"
 #include "openvino/core/graph_util.hpp"
@@ -147,16 +149,52 @@ void update_parameter_info(std::shared_ptr<ov::op::v0::Parameter>& param,
 }
 }  // namespace
 
-FrontEnd::FrontEnd() {}
+// Translator tables merged with the op extensions per decoder type. Tables are handed out as immutable snapshots,
+// so a conversion keeps using its table while another thread registers a new extension.
+class FrontEnd::SupportedOpsCache {
+public:
+    using OpsTable = std::unordered_map<std::string, CreatorFunction>;
+
+    void set_extension_translators(const std::map<std::string, CreatorFunction>& translators) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_extension_translators = translators;
+        m_merged_ops.clear();
+    }
+
+    std::shared_ptr<const OpsTable> get(const std::string& decoder_type) {
+        const auto& default_ops = decoder_type == "fx" ? get_supported_ops_fx() : get_supported_ops_ts();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_extension_translators.empty()) {
+            // default tables are function-local statics, the snapshot doesn't own them
+            return std::shared_ptr<const OpsTable>(std::shared_ptr<void>(), &default_ops);
+        }
+        auto& merged_ops = m_merged_ops[decoder_type];
+        if (!merged_ops) {
+            auto supported_ops = std::make_shared<OpsTable>(default_ops);
+            for (const auto& ext : m_extension_translators) {
+                (*supported_ops)[ext.first] = ext.second;
+            }
+            merged_ops = std::move(supported_ops);
+        }
+        return merged_ops;
+    }
+
+private:
+    std::map<std::string, CreatorFunction> m_extension_translators;
+    std::unordered_map<std::string, std::shared_ptr<const OpsTable>> m_merged_ops;
+    std::mutex m_mutex;
+};
+
+FrontEnd::FrontEnd() : m_supported_ops_cache(std::make_shared<SupportedOpsCache>()) {}
 
 std::shared_ptr<Model> FrontEnd::convert(const ov::frontend::InputModel::Ptr& model) const {
     auto pt_model = std::dynamic_pointer_cast<pytorch::InputModel>(model);
     FRONT_END_GENERAL_CHECK(pt_model, "Invalid input model");
-    const auto& supported_ops = get_supported_ops(model);
+    const auto supported_ops = m_supported_ops_cache->get(pt_model->decoder_type_name());
     std::shared_ptr<Model> converted_model;
     {
         pt_model->flush_places();
-        TranslateSession translate_session(model, supported_ops, m_telemetry);
+        TranslateSession translate_session(model, *supported_ops, m_telemetry);
         converted_model = translate_session.get_converted_model();
     }
 
@@ -233,11 +271,11 @@ void FrontEnd::convert(const std::shared_ptr<Model>& partiallyConverted) const {
 std::shared_ptr<Model> FrontEnd::convert_partially(const ov::frontend::InputModel::Ptr& model) const {
     auto pt_model = std::dynamic_pointer_cast<pytorch::InputModel>(model);
     FRONT_END_GENERAL_CHECK(pt_model, "Invalid input model");
-    const auto& supported_ops = get_supported_ops(model);
+    const auto supported_ops = m_supported_ops_cache->get(pt_model->decoder_type_name());
     std::shared_ptr<Model> partial_model;
     {
         pt_model->flush_places();
-        TranslateSession translate_session(model, supported_ops, m_telemetry);
+        TranslateSession translate_session(model, *supported_ops, m_telemetry);
         partial_model = translate_session.get_converted_model();
     }
     try {
@@ -371,11 +409,13 @@ void FrontEnd::add_extension(const std::shared_ptr<ov::Extension>& extension) {
         m_op_extension_translators[conv_ext->get_op_type()] = [=](const NodeContext& context) {
             return conv_ext->get_converter()(context);
         };
+        m_supported_ops_cache->set_extension_translators(m_op_extension_translators);
     } else if (auto conv_ext = ov::as_type_ptr<ov::frontend::pytorch::ConversionExtension>(extension)) {
         m_conversion_extensions.push_back(conv_ext);
         m_op_extension_translators[conv_ext->get_op_type()] = [=](const NodeContext& context) {
             return conv_ext->get_converter()(context);
         };
+        m_supported_ops_cache->set_extension_translators(m_op_extension_translators);
     } else if (const auto& so_ext = std::dynamic_pointer_cast<ov::detail::SOExtension>(extension)) {
         add_extension(so_ext->extension());
         m_extensions.push_back(so_ext);
@@ -417,15 +457,8 @@ ov::frontend::InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& va
 
 std::unordered_map<std::string, CreatorFunction> FrontEnd::get_supported_ops(
     const ov::frontend::InputModel::Ptr& model) const {
-    std::unordered_map<std::string, CreatorFunction> supported_ops;
-    if (std::dynamic_pointer_cast<pytorch::InputModel>(model)->decoder_type_name() == "fx")
-        supported_ops = get_supported_ops_fx();
-    else
-        supported_ops = get_supported_ops_ts();
-    for (const auto& ext : m_op_extension_translators) {
-        supported_ops[ext.first] = ext.second;
-    }
-    return supported_ops;
+    const auto decoder_type = std::dynamic_pointer_cast<pytorch::InputModel>(model)->decoder_type_name();
+    return *m_supported_ops_cache->get(decoder_type);
 }
 
 }  // namespace pytorch
@@ -362,8 +362,8 @@ OP_CONVERTER(translate_linear_ext);
 }  // namespace op
 
 // Supported ops for TorchScript
-const std::unordered_map<std::string, CreatorFunction> get_supported_ops_ts() {
-    return {
+const std::unordered_map<std::string, CreatorFunction>& get_supported_ops_ts() {
+    static const std::unordered_map<std::string, CreatorFunction> supported_ops = {
         {"aten::__and__", op::translate_bitwise_and},
         {"aten::__iand__", op::inplace_op<op::translate_bitwise_and>},
         {"aten::__lshift__", op::translate_bitwise_left_shift},
@@ -802,10 +802,11 @@ const std::unordered_map<std::string, CreatorFunction> get_supported_ops_ts() {
         {"torchvision::nms", op::translate_nms},
         {"torchvision::roi_align", op::translate_roi_align},
     };
+    return supported_ops;
 };
 
-const std::unordered_map<std::string, CreatorFunction> get_supported_ops_fx() {
-    return {
+const std::unordered_map<std::string, CreatorFunction>& get_supported_ops_fx() {
+    static const std::unordered_map<std::string, CreatorFunction> supported_ops = {
         {"<built-in function add>", op::translate_add},
         {"<built-in function floordiv>", op::translate_floor_divide},
         {"<built-in function getitem>", op::translate_getitem},  // TODO: Check if there is any other way to handle this
@@ -1099,6 +1100,7 @@ const std::unordered_map<std::string, CreatorFunction> get_supported_ops_fx() {
         {"quantized_decomposed.dequantize_per_channel.default", op::skip_node},
         {"inlined.constant.default", op::translate_constant},  // this is a custom ov type
     };
+    return supported_ops;
 };
 
 }  // namespace pytorch
@@ -10,8 +10,9 @@ namespace ov {
 namespace frontend {
 namespace pytorch {
 
-const std::unordered_map<std::string, CreatorFunction> get_supported_ops_ts();
-const std::unordered_map<std::string, CreatorFunction> get_supported_ops_fx();
+// translator tables are built once on the first request and shared by all conversions
+const std::unordered_map<std::string, CreatorFunction>& get_supported_ops_ts();
+const std::unordered_map<std::string, CreatorFunction>& get_supported_ops_fx();
 
 }  // namespace pytorch
 }  // namespace frontend
@@ -51,6 +51,11 @@ void CheckpointV1Reader::initialize() {
     }
 
     m_variables_info_map.clear();
+    m_shards.clear();
+    m_shard_names.clear();
+    m_shard_sizes.clear();
+    m_index_blocks.clear();
+    m_index_restart_offsets.clear();
 
     for (auto checkpoint_path : checkpoints_paths) {
         // create ifstream for each shard
@@ -60,10 +65,23 @@ void CheckpointV1Reader::initialize() {
             shard_stream && shard_stream->is_open(),
             "[TensorFlow Frontend] incorrect model: checkpoint file " + checkpoint_path + "does not exist");
         const int32_t shard_ind = static_cast<int32_t>(m_shards.size());
+        shard_stream->seekg(0, shard_stream->end);
+        m_shard_sizes.push_back(static_cast<uint64_t>(shard_stream->tellg()));
         m_shards.push_back(shard_stream);
         m_shard_names.push_back(checkpoint_path);
+
+        // read footer of the shard file to get offset and size of index block
+        // and keep the decoded index block for all further lookups in this shard
+        VIFooter footer;
+        footer.read(*shard_stream);
+        std::string index_block;
+        uint64_t index_restart_offset = 0;
+        init_block(shard_ind, footer.m_index.m_offset, footer.m_index.m_size, index_block, index_restart_offset);
+        m_index_blocks.push_back(std::move(index_block));
+        m_index_restart_offsets.push_back(index_restart_offset);
+
         std::string value;
-        find_entry(shard_stream, checkpoint_path, SAVED_TENSOR_SLICES_KEY, value);
+        find_entry(shard_ind, SAVED_TENSOR_SLICES_KEY, value);
 
         // parse empty index block
         // This is only present at the first item of each checkpoint file and serves
@@ -138,17 +156,17 @@ void CheckpointV1Reader::seek_block(const std::string& shard_name,
         "[TensorFlow Frontend] incorrect input model: checkpoint file " + shard_name + " can be incorrect");
 }
 
-void CheckpointV1Reader::init_block(const std::shared_ptr<std::ifstream>& shard,
-                                    const std::string& shard_name,
+void CheckpointV1Reader::init_block(const int32_t shard_id,
                                     uint64_t offset,
                                     uint64_t size,
                                     std::string& block,
                                     uint64_t& restart_offset) const {
+    const auto& shard = m_shards[shard_id];
+    const auto& shard_name = m_shard_names[shard_id];
     // check a size of the shard
     FRONT_END_GENERAL_CHECK(shard,
                             "[TensorFlow Frontend] internal error: nullptr pointer to checkpoint file " + shard_name);
-    shard->seekg(0, shard->end);
-    uint64_t shard_size = static_cast<uint64_t>(shard->tellg());
+    uint64_t shard_size = m_shard_sizes[shard_id];
     FRONT_END_GENERAL_CHECK(offset < shard_size,
                             "[TensorFlow Frontend] internal error or inconsistent checkpoint file: block offset is "
                             "out-of-range for checkpoint file " +
@@ -159,33 +177,35 @@ void CheckpointV1Reader::init_block(const std::shared_ptr<std::ifstream>& shard,
                             "out-of-range for checkpoint file " +
                                 shard_name);
 
-    // read a block and decompress if needed
-    std::vector<char> buf(n);
+    // read a block together with its trailer directly into the resulting string
+    // uncompressed blocks are then used in place, compressed ones are decompressed from it
+    block.resize(n);
     shard->seekg(offset);
-    shard->read(buf.data(), n);
+    shard->read(&block[0], n);
+    const char compression_type = block[size];
 #ifndef ENABLE_SNAPPY_COMPRESSION
-    FRONT_END_GENERAL_CHECK(buf[size] == 0,
+    FRONT_END_GENERAL_CHECK(compression_type == 0,
                             "[TensorFlow Frontend] internal error: compression method for given block is not supported "
                             "for checkpoint file " +
                                 shard_name);
-    block = std::string(buf.data(), size);
+    block.resize(size);
 #else
-    FRONT_END_GENERAL_CHECK(buf[size] == 0 || buf[size] == 1,
+    FRONT_END_GENERAL_CHECK(compression_type == 0 || compression_type == 1,
                             "[TensorFlow Frontend] internal error: compression method for given block is not supported "
                             "for checkpoint file " +
                                 shard_name);
-    if (buf[size] == 1) {
+    if (compression_type == 1) {
         size_t uncompressed_length = 0;
         FRONT_END_GENERAL_CHECK(
-            snappy::GetUncompressedLength(buf.data(), n, &uncompressed_length),
+            snappy::GetUncompressedLength(block.data(), n, &uncompressed_length),
             "[TensorFlow Frontend] internal error: cannot retrieve uncompressed block length for checkpoint file " +
                 shard_name);
-        std::string uncompressed_string;
-        block.clear();
-        block.reserve(uncompressed_length);
-        snappy::Uncompress(buf.data(), n, &block);
+        std::string uncompressed_block;
+        uncompressed_block.reserve(uncompressed_length);
+        snappy::Uncompress(block.data(), n, &uncompressed_block);
+        block = std::move(uncompressed_block);
     } else {
-        block = std::string(buf.data(), size);
+        block.resize(size);
     }
 #endif
     const char* data = block.data();
@@ -205,30 +225,28 @@ void CheckpointV1Reader::init_block(const std::shared_ptr<std::ifstream>& shard,
     restart_offset = size - (1 + num_restarts) * sizeof(uint32_t);
 }
 
-void CheckpointV1Reader::find_entry(const std::shared_ptr<std::ifstream>& shard,
-                                    const std::string& shard_name,
+void CheckpointV1Reader::find_entry(const int32_t shard_id,
                                     const std::string& entry_key,
-                                    std::string& entry_value) {
-    // read footer of the shard file to get offset and size of index block
-    VIFooter footer;
-    footer.read(*shard);
-    uint64_t block_offset = footer.m_index.m_offset;
-    uint64_t block_size = footer.m_index.m_size;
-    std::string block;
-
-    // initialize index block
-    uint64_t restart_offset = 0;
-    init_block(shard, shard_name, block_offset, block_size, block, restart_offset);
+                                    std::string& entry_value) const {
+    const auto& shard_name = m_shard_names[shard_id];
 
-    // seek entry in the index block
+    // seek entry in the cached index block
     // this entry contains offset and size of the data block
-    seek_block(shard_name, entry_key, block.data(), static_cast<uint32_t>(restart_offset), entry_value);
+    seek_block(shard_name,
+               entry_key,
+               m_index_blocks[shard_id].data(),
+               static_cast<uint32_t>(m_index_restart_offsets[shard_id]),
+               entry_value);
 
     // initialize the data block
+    uint64_t block_offset = 0;
+    uint64_t block_size = 0;
     FRONT_END_GENERAL_CHECK(
         get_varint64(entry_value, &block_offset) && get_varint64(entry_value, &block_size),
         "[TensorFlow Frontend] incorrect input model: bad block handle in checkpoint file " + shard_name);
-    init_block(shard, shard_name, block_offset, block_size, block, restart_offset);
+    std::string block;
+    uint64_t restart_offset = 0;
+    init_block(shard_id, block_offset, block_size, block, restart_offset);
 
     // seek the final entry in the data block
     seek_block(shard_name, entry_key, block.data(), static_cast<uint32_t>(restart_offset), entry_value);
@@ -239,18 +257,16 @@ void CheckpointV1Reader::read_variable(const std::string& variable_name, ov::Any
                             "[TensorFlow Frontend] incorrect input model: checkpoint files does not contain data for "
                             "the required variable " +
                                 variable_name);
-    auto var_info = m_variables_info_map[variable_name];
-    auto shard_id = m_variables_info_map[variable_name].shard_id;
+    const auto& var_info = m_variables_info_map[variable_name];
+    auto shard_id = var_info.shard_id;
     FRONT_END_GENERAL_CHECK(shard_id < static_cast<int32_t>(m_shards.size()),
                             "[TensorFlow Frontend] internal error: shard_id is greater than a number of shards");
     FRONT_END_GENERAL_CHECK(
         m_shards.size() == m_shard_names.size(),
         "[TensorFlow Frontend] internal error: number of shards does not match a number of their names");
-    auto shard_ptr = m_shards[shard_id];
-    auto shard_name = m_shard_names[shard_id];
     auto encoded_name = encode_tensor_name_slice(variable_name, var_info.starts, var_info.lenghts);
     std::string raw_data;
-    find_entry(shard_ptr, shard_name, encoded_name, raw_data);
+    find_entry(shard_id, encoded_name, raw_data);
 
     // This is only present at the first item of each checkpoint file and serves
     // as a table of contents, listing all the tensor slices saved in this file.
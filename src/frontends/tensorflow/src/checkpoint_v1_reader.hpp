@@ -38,6 +38,12 @@ class CheckpointV1Reader {
     std::vector<std::shared_ptr<std::ifstream>> m_shards;
     // a vector of shard names
     std::vector<std::string> m_shard_names;
+    // a vector of shard sizes in bytes
+    std::vector<uint64_t> m_shard_sizes;
+    // a vector of decoded index blocks for shards and their restart offsets
+    // the index block is shared by all entries of the shard so it is read and decompressed once
+    std::vector<std::string> m_index_blocks;
+    std::vector<uint64_t> m_index_restart_offsets;
 
 public:
     /// \brief constructs CheckpointV1Reader for a given directory of checkpoint files
@@ -55,10 +61,7 @@ public:
 
 private:
     /// \brief finds non-master key entry that uses already cached offset and sizes of data blocks
-    void find_entry(const std::shared_ptr<std::ifstream>& shard,
-                    const std::string& shard_name,
-                    const std::string& entry_key,
-                    std::string& value);
+    void find_entry(const int32_t shard_id, const std::string& entry_key, std::string& value) const;
 
     void seek_block(const std::string& shard_name,
                     const std::string& target,
@@ -66,8 +69,7 @@ private:
                     const uint32_t restarts,
                     std::string& value) const;
 
-    void init_block(const std::shared_ptr<std::ifstream>& shard,
-                    const std::string& shard_name,
+    void init_block(const int32_t shard_id,
                     uint64_t offset,
                     uint64_t size,
                     std::string& block,
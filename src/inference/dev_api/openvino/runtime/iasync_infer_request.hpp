@@ -133,6 +133,14 @@ public:
      */
     std::vector<ov::SoPtr<ov::IVariableState>> query_state() const override;
 
+    /**
+     * @brief Sets the outputs which are going to be read after the inference.
+     * The plugin may skip the computations which contribute only to the other outputs.
+     *
+     * @param ports Output ports
+     */
+    void set_required_outputs(const std::vector<ov::Output<const ov::Node>>& ports) override;
+
     /**
      * @brief Gets pointer to compiled model (usually synchronous request holds the compiled model)
      *
@@ -123,6 +123,18 @@ protected:
      */
     virtual void check_tensors() const = 0;
     friend IAsyncInferRequest;
+
+public:
+    /**
+     * @brief Sets the outputs which are going to be read after the inference.
+     * It is a hint: the plugin may skip the computations which contribute only to the other outputs,
+     * so the values of the other outputs are undefined. An empty vector means all the outputs are required.
+     * The default implementation ignores the hint.
+     * @note The new virtual method changes the vtable of the derived infer requests, so the plugins must be rebuilt.
+     *
+     * @param ports Output ports
+     */
+    virtual void set_required_outputs(const std::vector<ov::Output<const ov::Node>>& ports);
 };
 
 };  // namespace ov
@@ -51,6 +51,13 @@ public:
      */
     virtual ov::SoPtr<ov::ITensor> get_state() const;
 
+    /**
+     * @brief Returns a read-only snapshot of the variable state. The snapshot keeps its value when the state is
+     * updated and can be passed to set_state() to restore the state. The default implementation copies the state.
+     * @return The snapshot of the variable state
+     */
+    virtual ov::SoPtr<ov::ITensor> snapshot();
+
 protected:
     /**
      * @brief A default dtor
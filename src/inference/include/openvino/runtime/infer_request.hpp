@@ -252,6 +252,15 @@ public:
      */
     Tensor get_output_tensor();
 
+    /**
+     * @brief Sets the outputs which are going to be read after the following inferences.
+     * It is a hint: the plugin may skip the computations which contribute only to the other outputs,
+     * so the values of the other output tensors are undefined.
+     * @note Not all plugins skip the computations, but all of them produce the required outputs.
+     * @param ports Ports of the required outputs. An empty vector means that all the outputs are required.
+     */
+    void set_required_outputs(const std::vector<ov::Output<const ov::Node>>& ports);
+
     /**
      * @brief Infers specified input(s) in synchronous mode.
      * @note It blocks all methods of InferRequest while request is ongoing (running or waiting in a queue).
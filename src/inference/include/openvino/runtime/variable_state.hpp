@@ -69,6 +69,16 @@ public:
      */
     Tensor get_state() const;
 
+    /**
+     * @brief Returns a read-only snapshot of the variable state.
+     * @note The snapshot keeps its value while the state is updated by the following inferences, reset() or
+     * set_state() calls. A plugin may share the snapshot memory with the state until the state is updated, so the
+     * snapshot data must not be modified. Pass the snapshot to set_state() to restore the state or to fork it into
+     * another infer request.
+     * @return A tensor representing the state snapshot.
+     */
+    Tensor snapshot();
+
     /**
      * @brief Sets the new state for the next inference.
      * @param state The current state to set.
@@ -223,6 +223,10 @@ void InferRequest::infer() {
     OV_INFER_REQ_CALL_STATEMENT(_impl->infer());
 }
 
+void InferRequest::set_required_outputs(const std::vector<ov::Output<const ov::Node>>& ports) {
+    OV_INFER_REQ_CALL_STATEMENT(_impl->set_required_outputs(ports));
+}
+
 void InferRequest::cancel() {
     OV_INFER_REQ_CALL_STATEMENT(_impl->cancel());
 }
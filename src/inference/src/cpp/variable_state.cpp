@@ -45,6 +45,13 @@ Tensor VariableState::get_state() const {
     });
 }
 
+Tensor VariableState::snapshot() {
+    OV_VARIABLE_CALL_STATEMENT({
+        auto tensor = _impl->snapshot();
+        return make_tensor(tensor);
+    });
+}
+
 void VariableState::set_state(const Tensor& state) {
     OV_VARIABLE_CALL_STATEMENT(_impl->set_state(get_tensor_impl(state)));
 }
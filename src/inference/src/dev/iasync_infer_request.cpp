@@ -108,6 +108,11 @@ std::vector<ov::SoPtr<ov::IVariableState>> ov::IAsyncInferRequest::query_state()
     return m_sync_request->query_state();
 }
 
+void ov::IAsyncInferRequest::set_required_outputs(const std::vector<ov::Output<const ov::Node>>& ports) {
+    check_state();
+    m_sync_request->set_required_outputs(ports);
+}
+
 void ov::IAsyncInferRequest::infer_thread_unsafe() {
     run_first_stage(m_sync_pipeline.begin(), m_sync_pipeline.end(), m_sync_callback_executor);
 }
@@ -92,6 +92,8 @@ void check_batched_tensors(const ov::Output<const ov::Node>& input,
 
 ov::IInferRequest::~IInferRequest() = default;
 
+void ov::IInferRequest::set_required_outputs([[maybe_unused]] const std::vector<ov::Output<const ov::Node>>& ports) {}
+
 ov::ISyncInferRequest::ISyncInferRequest(const std::shared_ptr<const ov::ICompiledModel>& compiled_model)
     : m_compiled_model(compiled_model) {
     OPENVINO_ASSERT(m_compiled_model);
@@ -5,6 +5,7 @@
 #include "openvino/runtime/ivariable_state.hpp"
 
 #include "openvino/core/except.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 
 ov::IVariableState::IVariableState(const std::string& name) : m_name(name) {}
 
@@ -25,3 +26,11 @@ void ov::IVariableState::set_state(const ov::SoPtr<ov::ITensor>& state) {
 ov::SoPtr<ov::ITensor> ov::IVariableState::get_state() const {
     return m_state;
 }
+
+ov::SoPtr<ov::ITensor> ov::IVariableState::snapshot() {
+    const auto state = get_state();
+    OPENVINO_ASSERT(state, "The state of variable ", get_name(), " is not initialized");
+    auto copy = ov::make_tensor(state->get_element_type(), state->get_shape());
+    state->copy_to(copy);
+    return {copy, state._so};
+}
@@ -437,6 +437,70 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                ov::intel_cpu::enable_tensor_parallel.name(),
                                ". Expected only true/false.");
             }
+        } else if (key == ov::intel_cpu::lazy_subgraph_activation.name()) {
+            try {
+                lazySubgraphActivation = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               "for property key ",
+                               ov::intel_cpu::lazy_subgraph_activation.name(),
+                               ". Expected only true/false.");
+            }
+        } else if (key == ov::intel_cpu::executor_tuning_db.name()) {
+            executorTuningDb = val.as<std::string>();
+        } else if (key == ov::intel_cpu::lm_head_sampling_fusion.name()) {
+            try {
+                enableLMHeadSamplingFusion = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               "for property key ",
+                               ov::intel_cpu::lm_head_sampling_fusion.name(),
+                               ". Expected only true/false.");
+            }
+        } else if (key == ov::intel_cpu::early_exit.name()) {
+            try {
+                enableEarlyExit = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               "for property key ",
+                               ov::intel_cpu::early_exit.name(),
+                               ". Expected only true/false.");
+            }
+        } else if (key == ov::intel_cpu::kv_cache_sink_size.name() ||
+                   key == ov::intel_cpu::kv_cache_window_size.name()) {
+            try {
+                const auto size = val.as<uint64_t>();
+                if (key == ov::intel_cpu::kv_cache_sink_size.name()) {
+                    kvCacheSinkSize = size;
+                } else {
+                    kvCacheWindowSize = size;
+                }
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               key,
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (key == ov::intel_cpu::kv_cache_rope_theta.name()) {
+            try {
+                kvCacheRopeTheta = val.as<float>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::kv_cache_rope_theta.name(),
+                               ". Expected only non-negative float numbers");
+            }
+            OPENVINO_ASSERT(kvCacheRopeTheta >= 0.0F,
+                            "Wrong value ",
+                            kvCacheRopeTheta,
+                            " for property key ",
+                            ov::intel_cpu::kv_cache_rope_theta.name(),
+                            ". Expected only non-negative float numbers");
         } else if (key == ov::cache_encryption_callbacks.name()) {
             try {
                 const auto& encryption_callbacks = val.as<EncryptionCallbacks>();
@@ -101,6 +101,13 @@ struct Config {
     ov::hint::SchedulingCoreType schedulingCoreType = ov::hint::SchedulingCoreType::ANY_CORE;
     std::set<ov::hint::ModelDistributionPolicy> modelDistributionPolicy;
     bool enableTensorParallel = false;
+    bool lazySubgraphActivation = false;
+    std::string executorTuningDb;
+    bool enableLMHeadSamplingFusion = false;
+    bool enableEarlyExit = false;
+    size_t kvCacheSinkSize = 0ul;
+    size_t kvCacheWindowSize = 0ul;
+    float kvCacheRopeTheta = 10000.0F;
     int streamsRankLevel = 1;
     int numSubStreams = 0;
     bool enableNodeSplit = false;
@@ -124,6 +131,10 @@ struct Config {
     // is reserved.
     bool DAZOn = false;
 
+    // The f32 constants of the model are known to have no subnormals (e.g. they were flushed on export),
+    // so they don't need to be checked when the graph is created.
+    bool weightsSubnormalsFlushed = false;
+
     void readProperties(const ov::AnyMap& prop, ModelType modelType = ModelType::Unknown);
 
     void updateProperties();
@@ -243,6 +243,7 @@ static const TypeToNameMap& get_type_to_name_tbl() {
         {"MulticlassNms", Type::MulticlassNms},
         {"MulticlassNmsIEInternal", Type::MulticlassNms},
         {"Multinomial", Type::Multinomial},
+        {"LMHeadSampling", Type::LMHeadSampling},
         {"Reference", Type::Reference},
         {"Subgraph", Type::Subgraph},
         {"SubModel", Type::SubModel},
@@ -262,6 +263,7 @@ static const TypeToNameMap& get_type_to_name_tbl() {
         {"EmbeddingBagOffsets", Type::EmbeddingBagOffsets},
         {"LLMMLP", Type::LLMMLP},
         {"QKVProjection", Type::QKVProjection},
+        {"MoE", Type::MoE},
         {"RMS", Type::RMS},
         {"SearchSorted", Type::SearchSorted},
         {"LoraSubgraph", Type::LoRA}};
@@ -380,6 +382,7 @@ std::string NameFromType(const Type type) {
         CASE(MatrixNms);
         CASE(MulticlassNms);
         CASE(Multinomial);
+        CASE(LMHeadSampling);
         CASE(Reference);
         CASE(Subgraph);
         CASE(SubModel);
@@ -394,6 +397,7 @@ std::string NameFromType(const Type type) {
         CASE(CausalMaskPreprocess);
         CASE(LLMMLP);
         CASE(QKVProjection);
+        CASE(MoE);
         CASE(RMS);
         CASE(SearchSorted);
         CASE(SegmentMax);
@@ -119,6 +119,7 @@ enum class Type : uint8_t {
     MatrixNms,
     MulticlassNms,
     Multinomial,
+    LMHeadSampling,
     Subgraph,
     SubModel,
     PriorBox,
@@ -133,6 +134,7 @@ enum class Type : uint8_t {
     CausalMaskPreprocess,
     LLMMLP,
     QKVProjection,
+    MoE,
     RMS,
     SearchSorted,
     SegmentMax,
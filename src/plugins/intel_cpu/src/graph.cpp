@@ -386,7 +386,17 @@ void Graph::Activate() {
     // the allocation context collection from the outer graph so the state for inner graph is "Ready"
     // We probably want to avoid such uncertancy
     // OPENVINO_ASSERT(status == Status::Initialized, "Invalid graph status: ", static_cast<int>(status));
+    ActivateLazily();
+    CreateDeferredPrimitives();
+}
+
+void Graph::ActivateLazily() {
     Allocate();
+    m_primitivesDeferred = true;
+}
+
+void Graph::CreateDeferredPrimitives() {
+    m_primitivesDeferred = false;
 
     CreatePrimitivesAndExecConstants();
 
@@ -892,6 +902,8 @@ std::vector<size_t> Graph::CreateExecutionGraph() {
 
     std::tie(m_executableGraphNodes, m_executableSyncNodesInds) =
         ExtractExecutableNodesAndSyncPoints(syncNodesInds, graphNodes);
+    m_executionMasks.clear();
+    m_exitPoints.clear();
 
     if (hasDynNodes) {
         status = Status::ReadyDynamic;
@@ -906,6 +918,9 @@ std::vector<size_t> Graph::CreateExecutionGraph() {
         }
     } else {
         status = Status::ReadyStatic;
+        if (getConfig().enableEarlyExit) {
+            ResolveExitPoints();
+        }
     }
 
     return syncNodesInds;
@@ -1350,10 +1365,165 @@ VecMemoryDescs Graph::getOutputMemoryDescriptors() const {
     return result;
 }
 
-void Graph::InferStatic(SyncInferRequest* request, int numaId) {
-    for (const auto& node : m_executableGraphNodes) {
-        ExecuteNodeWithCatch(node, request, numaId);
+static bool isConditionTrue(const IMemory& condition) {
+    float value = 0.F;
+    cpu_convert(condition.getData(), &value, condition.getPrecision(), ov::element::f32, 1);
+    return value != 0.F;
+}
+
+void Graph::InferStatic(SyncInferRequest* request, int numaId, const std::vector<size_t>& requiredOutputs) {
+    if (requiredOutputs.empty() && m_exitPoints.empty()) {
+        for (const auto& node : m_executableGraphNodes) {
+            ExecuteNodeWithCatch(node, request, numaId);
+        }
+        return;
+    }
+
+    auto executionMask = requiredOutputs.empty() ? std::vector<bool>(m_executableGraphNodes.size(), true)
+                                                 : GetExecutionMask(requiredOutputs);
+    auto exitPoint = m_exitPoints.begin();
+    for (size_t i = 0; i < m_executableGraphNodes.size(); i++) {
+        for (; exitPoint != m_exitPoints.end() && exitPoint->position == i; ++exitPoint) {
+            const auto& skipped =
+                isConditionTrue(exitPoint->condition->getMemory()) ? exitPoint->skipIfTrue : exitPoint->skipIfFalse;
+            for (const auto idx : skipped) {
+                executionMask[idx] = false;
+            }
+        }
+        if (executionMask[i]) {
+            ExecuteNodeWithCatch(m_executableGraphNodes[i], request, numaId);
+        }
+    }
+}
+
+std::unordered_set<const Node*> Graph::CollectLiveNodes(const std::vector<size_t>& requiredOutputs,
+                                                        const Edge* cutEdge) const {
+    std::deque<Node*> toVisit;
+    if (requiredOutputs.empty()) {
+        for (const auto& node : outputNodes) {
+            toVisit.push_back(node.get());
+        }
+    }
+    for (const auto idx : requiredOutputs) {
+        OPENVINO_ASSERT(idx < outputNodes.size(), "Unexpected output index: ", idx);
+        toVisit.push_back(outputNodes[idx].get());
+    }
+    // the sinks (e.g. the state updates) have side effects, so they are executed regardless of the outputs
+    for (const auto& node : graphNodes) {
+        if (node->getChildEdges().empty() && node->getType() != Type::Output) {
+            toVisit.push_back(node.get());
+        }
+    }
+
+    std::unordered_set<const Node*> live;
+    while (!toVisit.empty()) {
+        auto* node = toVisit.front();
+        toVisit.pop_front();
+        if (!live.insert(node).second) {
+            continue;
+        }
+        for (const auto& weakEdge : node->getParentEdges()) {
+            const auto edge = weakEdge.lock();
+            if (edge.get() != cutEdge) {
+                toVisit.push_back(edge->getParent().get());
+            }
+        }
+    }
+
+    return live;
+}
+
+const std::vector<bool>& Graph::GetExecutionMask(const std::vector<size_t>& requiredOutputs) {
+    auto found = m_executionMasks.find(requiredOutputs);
+    if (found != m_executionMasks.end()) {
+        return found->second;
+    }
+
+    const auto live = CollectLiveNodes(requiredOutputs);
+    std::vector<bool> executionMask(m_executableGraphNodes.size());
+    for (size_t i = 0; i < m_executableGraphNodes.size(); i++) {
+        executionMask[i] = live.count(m_executableGraphNodes[i].get()) != 0;
+    }
+    DEBUG_LOG("Graph ",
+              GetName(),
+              " executes ",
+              std::count(executionMask.begin(), executionMask.end(), true),
+              " of ",
+              executionMask.size(),
+              " nodes for the required outputs");
+
+    return m_executionMasks.emplace(requiredOutputs, std::move(executionMask)).first->second;
+}
+
+void Graph::ResolveExitPoints() {
+    std::unordered_map<const Node*, size_t> positions;
+    for (size_t i = 0; i < m_executableGraphNodes.size(); i++) {
+        positions[m_executableGraphNodes[i].get()] = i;
     }
+
+    const auto live = CollectLiveNodes({});
+    for (const auto& node : m_executableGraphNodes) {
+        if (node->getType() != Type::Eltwise || node->getAlgorithm() != Algorithm::EltwiseSelect) {
+            continue;
+        }
+        const auto& conditionShape = node->getInputShapeAtPort(0);
+        if (!conditionShape.isStatic() || conditionShape.getElementsCount() != 1) {
+            continue;
+        }
+
+        // the condition can be evaluated once all its executable producers are executed
+        size_t position = 0;
+        std::deque<const Node*> toVisit{node->getParentEdgeAt(0)->getParent().get()};
+        std::unordered_set<const Node*> visited;
+        while (!toVisit.empty()) {
+            const auto* parent = toVisit.front();
+            toVisit.pop_front();
+            if (!visited.insert(parent).second) {
+                continue;
+            }
+            auto found = positions.find(parent);
+            if (found != positions.end()) {
+                position = std::max(position, found->second + 1);
+            }
+            for (const auto& edge : parent->getParentEdges()) {
+                toVisit.push_back(edge.lock()->getParent().get());
+            }
+        }
+
+        // the nodes which become dead without the branch input are needed only by this branch
+        auto onlyNeededBy = [&](size_t port) {
+            const auto liveWithoutBranch = CollectLiveNodes({}, node->getParentEdgeAt(port).get());
+            std::vector<size_t> skipped;
+            for (size_t i = position; i < m_executableGraphNodes.size(); i++) {
+                const auto* candidate = m_executableGraphNodes[i].get();
+                if (live.count(candidate) != 0 && liveWithoutBranch.count(candidate) == 0) {
+                    skipped.push_back(i);
+                }
+            }
+            return skipped;
+        };
+
+        ExitPoint exitPoint{position, node->getParentEdgeAt(0), onlyNeededBy(2), onlyNeededBy(1)};
+        if (exitPoint.skipIfTrue.empty() && exitPoint.skipIfFalse.empty()) {
+            continue;
+        }
+        DEBUG_LOG("Graph ",
+                  GetName(),
+                  " exit point ",
+                  node->getName(),
+                  " at ",
+                  position,
+                  " skips ",
+                  exitPoint.skipIfTrue.size(),
+                  " / ",
+                  exitPoint.skipIfFalse.size(),
+                  " nodes");
+        m_exitPoints.push_back(std::move(exitPoint));
+    }
+
+    std::sort(m_exitPoints.begin(), m_exitPoints.end(), [](const ExitPoint& lhs, const ExitPoint& rhs) {
+        return lhs.position < rhs.position;
+    });
 }
 
 namespace {
@@ -1642,12 +1812,16 @@ static int GetNumaNodeId([[maybe_unused]] const GraphContext::CPtr& context) {
     return numaNodeId;
 }
 
-void Graph::Infer(SyncInferRequest* request) {
+void Graph::Infer(SyncInferRequest* request, const std::vector<size_t>& requiredOutputs) {
     DEBUG_LOG("Infer graph: ", GetName(), ". Status: ", static_cast<int>(status));
     const int numaId = GetNumaNodeId(m_context);
 
     m_context->allocateMemory();
 
+    if (m_primitivesDeferred) {
+        CreateDeferredPrimitives();
+    }
+
     switch (status) {
     case Status::ReadyDynamic:
         InferDynamic(request, numaId, UpdateNodes(m_executableGraphNodes));
@@ -1656,7 +1830,7 @@ void Graph::Infer(SyncInferRequest* request) {
         InferDynamic(request, numaId, UpdateNodesSeq(m_executableGraphNodes));
         break;
     case Status::ReadyStatic:
-        InferStatic(request, numaId);
+        InferStatic(request, numaId, requiredOutputs);
         break;
     default:
         OPENVINO_ASSERT(IsReady(),
@@ -6,6 +6,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
@@ -98,7 +99,14 @@ public:
     // Returns Output nodes memory descriptors
     VecMemoryDescs getOutputMemoryDescriptors() const;
 
-    void Infer(SyncInferRequest* request = nullptr);
+    /**
+     * Execute the graph
+     *
+     * @params request          Current inference request, which is checked for cancelation
+     * @params requiredOutputs  Sorted indices of the outputs to compute, the nodes which contribute only to the other
+     *                          outputs are skipped in the static graphs. Empty means all the outputs are computed.
+     */
+    void Infer(SyncInferRequest* request = nullptr, const std::vector<size_t>& requiredOutputs = {});
 
     const std::vector<NodePtr>& GetNodes() const {
         return graphNodes;
@@ -263,6 +271,12 @@ public:
      */
     void Activate();
 
+    /**
+     * Activate execution graph, but defer the primitives creation and the constants execution
+     * until the first Infer() call, so no work is done for a graph which is never executed
+     */
+    void ActivateLazily();
+
     /**
      * Register the graph in the global allocation context by transforming
      * local execution data into the global one:
@@ -295,8 +309,12 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         m_executableSyncNodesInds.clear();
+        m_executionMasks.clear();
+        m_exitPoints.clear();
+        m_primitivesDeferred = false;
     }
     Status status{Status::NotReady};
+    bool m_primitivesDeferred = false;
 
     // For dumping purposes. -1 - no counting, all other positive
     // values mean increment it within each Infer() call
@@ -325,6 +343,7 @@ protected:
     bool ProcessDynNodes() const;
     void AllocateWithReuse(const std::vector<size_t>& syncNodesInds, GlobalExecutionIndex globalExecIndex);
     void CreatePrimitivesAndExecConstants() const;
+    void CreateDeferredPrimitives();
     std::vector<size_t> CreateExecutionGraph();
 
     /**
@@ -346,7 +365,11 @@ protected:
      */
     void ExecuteNode(const NodePtr& node, SyncInferRequest* request = nullptr, int numaId = -1) const;
 
-    void InferStatic(SyncInferRequest* request, int numaId);
+    void InferStatic(SyncInferRequest* request, int numaId, const std::vector<size_t>& requiredOutputs);
+    const std::vector<bool>& GetExecutionMask(const std::vector<size_t>& requiredOutputs);
+    std::unordered_set<const Node*> CollectLiveNodes(const std::vector<size_t>& requiredOutputs,
+                                                     const Edge* cutEdge = nullptr) const;
+    void ResolveExitPoints();
     template <typename UpdateStrategy>
     void InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&& update);
 
@@ -370,6 +393,18 @@ private:
     // non-executable (optimized out) nodes, such as Input, Reshape, etc.
     std::vector<NodePtr> m_executableGraphNodes;
     std::vector<size_t> m_executableSyncNodesInds;
+    // the executable nodes which contribute to the given subsets of the outputs
+    std::map<std::vector<size_t>, std::vector<bool>> m_executionMasks;
+
+    // Select with a single element condition: once the condition is computed, the nodes which feed
+    // only the branch that is not taken are skipped for the rest of the static inference
+    struct ExitPoint {
+        size_t position;  // index in m_executableGraphNodes before which the condition is evaluated
+        EdgePtr condition;
+        std::vector<size_t> skipIfTrue;
+        std::vector<size_t> skipIfFalse;
+    };
+    std::vector<ExitPoint> m_exitPoints;
 
     GraphContext::CPtr m_context;
     dnnl::stream m_stream;
@@ -33,6 +33,7 @@
 #include "nodes/common/cpu_convert.h"
 #include "nodes/conv.h"
 #include "nodes/deconv.h"
+#include "nodes/embedding_bag.h"
 #include "nodes/eltwise.h"
 #include "nodes/fake_quantize.h"
 #include "nodes/fullyconnected.h"
@@ -104,10 +105,18 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph& graph) {
     FuseMultiplyAndAdd(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEmbeddingBagAndDecompression");
+    FuseEmbeddingBagAndDecompression(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "MergeConvertAndEltwise");
     MergeConvertAndEltwise(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "MergeConvertAndColorConvert");
+    MergeConvertAndColorConvert(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseFCAndConvertOnWeights");
     FuseFCAndConvertOnWeights(graph);
     graph.RemoveDroppedNodes();
@@ -826,6 +835,47 @@ void GraphOptimizer::MergeConvertAndEltwise(Graph& graph) {
     }
 }
 
+void GraphOptimizer::MergeConvertAndColorConvert(Graph& graph) {
+    // Preprocessing pipelines usually convert u8 NV12/I420 planes to f32 right before the color conversion.
+    // ColorConvert is able to read u8 planes and produce f32 output in a single pass, so the Converts
+    // along with their intermediate f32 copies of the planes are removed.
+    const auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableConvert = [](const NodePtr& node) {
+        return node->getType() == Type::Convert && node->getChildEdges().size() == 1 &&
+               node->getFusedWith().empty() && node->getOriginalInputPrecisionAtPort(0) == ov::element::u8 &&
+               node->getOriginalOutputPrecisionAtPort(0) == ov::element::f32;
+    };
+
+    for (const auto& childNode : graphNodes) {
+        if (childNode->getType() != Type::ColorConvert ||
+            childNode->getOriginalOutputPrecisionAtPort(0) != ov::element::f32) {
+            continue;
+        }
+
+        // all the planes must share the same precision
+        const auto& parentEdges = childNode->getParentEdges();
+        const bool allConverts = std::all_of(parentEdges.begin(), parentEdges.end(), [&](const EdgeWeakPtr& edge) {
+            return isSuitableConvert(edge.lock()->getParent());
+        });
+        if (!allConverts) {
+            continue;
+        }
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(MergeConvertAndColorConvert);
+
+        std::vector<NodePtr> converts;
+        for (size_t i = 0; i < childNode->getParentEdges().size(); i++) {
+            converts.push_back(childNode->getParentEdgeAt(i)->getParent());
+            childNode->setOriginalInputPrecisionAtPort(i, ov::element::u8);
+        }
+        for (const auto& convert : converts) {
+            childNode->addOriginalLayer(convert->getOriginalLayers());
+            graph.DropNode(convert);
+        }
+    }
+}
+
 void GraphOptimizer::FuseFCAndConvertOnWeights(Graph& graph) {
 #if defined(OV_CPU_WITH_SHL)
     return;
@@ -885,6 +935,117 @@ void GraphOptimizer::FuseFCAndConvertOnWeights(Graph& graph) {
     }
 }
 
+void GraphOptimizer::FuseEmbeddingBagAndDecompression(Graph& graph) {
+    // The row-quantized (u8/i8 -> Convert [-> Subtract] -> Multiply) or f16/bf16 (-> Convert) embedding tables are
+    // kept compressed, since the tables are huge and only a few rows are read per inference. The embedding bag node
+    // dequantizes the rows while they are accumulated.
+
+    auto isSuitableEltwise = [](const NodePtr& node, Algorithm algorithm) {
+        return node->getType() == Type::Eltwise && node->getAlgorithm() == algorithm && node->isConstant() &&
+               node->getParentEdges().size() == 2 && node->getChildEdges().size() == 1 && node->getFusedWith().empty();
+    };
+
+    // per row or scalar values, an optional Convert is dropped along with the decompression nodes
+    auto readRowValues = [](const NodePtr& node, size_t rows, size_t rank, std::vector<float>& values, NodePtr& cvt) {
+        auto constant = node;
+        if (constant->getType() == Type::Convert && constant->isConstant() && constant->getChildEdges().size() == 1) {
+            cvt = constant;
+            constant = constant->getParentEdgeAt(0)->getParent();
+        }
+        auto* input = dynamic_cast<node::Input*>(constant.get());
+        if (!input || !input->isConstant() || !input->getMemoryPtr()) {
+            return false;
+        }
+        const auto& shape = constant->getOutputShapeAtPort(0);
+        if (!shape.isStatic()) {
+            return false;
+        }
+        const auto dims = getNormalizedDimsBySize(shape.getDims(), rank);
+        const auto size = shape.getElementsCount();
+        if (dims.size() != rank || (size != 1 && (dims[0] != rows || size != rows))) {
+            return false;
+        }
+        const auto memory = input->getMemoryPtr();
+        values.resize(size);
+        cpu_convert(memory->getData(), values.data(), memory->getDesc().getPrecision(), ov::element::f32, size);
+        return true;
+    };
+
+    const auto& graphNodes = graph.GetNodes();
+    for (const auto& node : graphNodes) {
+        auto embeddingBag = std::dynamic_pointer_cast<node::EmbeddingBag>(node);
+        if (!embeddingBag || embeddingBag->isCompressed()) {
+            continue;
+        }
+
+        NodePtr multiply = nullptr;
+        NodePtr subtract = nullptr;
+        auto parent = node->getParentEdgeAt(0)->getParent();
+        if (isSuitableEltwise(parent, Algorithm::EltwiseMultiply)) {
+            multiply = parent;
+            parent = multiply->getParentEdgeAt(0)->getParent();
+            if (isSuitableEltwise(parent, Algorithm::EltwiseSubtract)) {
+                subtract = parent;
+                parent = subtract->getParentEdgeAt(0)->getParent();
+            }
+        }
+
+        const auto convert = parent;
+        if (convert->getType() != Type::Convert || !convert->isConstant() || convert->getChildEdges().size() != 1 ||
+            convert->getOriginalOutputPrecisionAtPort(0) != ov::element::f32) {
+            continue;
+        }
+        const auto tablePrecision = convert->getOriginalInputPrecisionAtPort(0);
+        if (multiply ? none_of(tablePrecision, ov::element::u8, ov::element::i8, ov::element::f16, ov::element::bf16)
+                     : none_of(tablePrecision, ov::element::f16, ov::element::bf16)) {
+            continue;
+        }
+        const auto table = convert->getParentEdgeAt(0)->getParent();
+        const auto& tableShape = table->getOutputShapeAtPort(0);
+        if (table->getType() != Type::Input || !table->isConstant() || !tableShape.isStatic() ||
+            tableShape.getRank() < 2) {
+            continue;
+        }
+
+        const auto rows = tableShape.getDims()[0];
+        const auto rank = tableShape.getRank();
+        std::vector<float> scales;
+        std::vector<float> zeroPoints;
+        NodePtr scalesConvert = nullptr;
+        NodePtr zeroPointsConvert = nullptr;
+        if (multiply &&
+            !readRowValues(multiply->getParentEdgeAt(1)->getParent(), rows, rank, scales, scalesConvert)) {
+            continue;
+        }
+        if (subtract &&
+            !readRowValues(subtract->getParentEdgeAt(1)->getParent(), rows, rank, zeroPoints, zeroPointsConvert)) {
+            continue;
+        }
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseEmbeddingBagAndDecompression);
+
+        embeddingBag->fuseDecompression(std::move(scales), std::move(zeroPoints));
+        node->setOriginalInputPrecisionAtPort(0, tablePrecision);
+
+        const auto inNum = convert->getParentEdgeAt(0)->getInputNum();
+        graph.RemoveEdge(node->getParentEdgeAt(0));
+        graph.CreateEdge(table, node, inNum, 0);
+        // the decompression nodes are left without consumers, so all their edges are removed
+        for (const auto& decompression : {multiply, subtract, convert, scalesConvert, zeroPointsConvert}) {
+            if (!decompression || !decompression->getChildEdges().empty()) {
+                continue;
+            }
+            node->addOriginalLayer(decompression->getOriginalLayers());
+            const auto parentEdges = decompression->getParentEdges();
+            for (const auto& edge : parentEdges) {
+                if (const auto parentEdge = edge.lock()) {
+                    graph.RemoveEdge(parentEdge);
+                }
+            }
+        }
+    }
+}
+
 void GraphOptimizer::FuseFCAndTransposeOnWeights(Graph& graph) {
 #if defined(OV_CPU_WITH_SHL)
     return;
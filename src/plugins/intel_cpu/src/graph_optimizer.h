@@ -26,8 +26,10 @@ private:
     static void FuseMultiplyAndAdd(Graph& graph);
     static void MergeEltwiseAndConvert(Graph& graph);
     static void MergeConvertAndEltwise(Graph& graph);
+    static void MergeConvertAndColorConvert(Graph& graph);
     static void FuseFCAndConvertOnWeights(Graph& graph);
     static void FuseFCAndTransposeOnWeights(Graph& graph);
+    static void FuseEmbeddingBagAndDecompression(Graph& graph);
     static void FuseFullyConnectedAndSimpleOperation(Graph& graph);
     static void FuseMatMulAndSimpleOperation(Graph& graph);
     static void FuseConvolutionAndSimpleOperationThroughMaxPool(Graph& graph);
@@ -4,7 +4,9 @@
 
 #include "infer_request.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <map>
@@ -29,9 +31,11 @@
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "node.h"
 #include "nodes/common/cpu_convert.h"
+#include "nodes/common/cpu_memcpy.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/node_output.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/shape.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
@@ -92,6 +96,50 @@ void SyncInferRequest::redefine_memory_for_input_nodes(Graph& graph) {
     }
 }
 
+void SyncInferRequest::assemble_batched_inputs() {
+    for (const auto& input_port : m_input_ports_map) {
+        const auto batched = m_batched_tensors.find(input_port.second.get_tensor_ptr());
+        if (batched == m_batched_tensors.end()) {
+            m_batched_inputs.erase(input_port.first);
+            continue;
+        }
+        const auto& tensors = batched->second;
+        const auto& first = tensors.front();
+        OPENVINO_ASSERT(first, "Unintialized tensor is provided!");
+        const auto sample_size = first->get_byte_size();
+        auto batched_shape = first->get_shape();
+        batched_shape[0] = tensors.size();
+
+        auto* const base_ptr = static_cast<uint8_t*>(first->data());
+        bool is_contiguous = true;
+        for (size_t i = 0; i < tensors.size() && is_contiguous; i++) {
+            is_contiguous = tensors[i]->is_continuous() && tensors[i]->data() == base_ptr + i * sample_size;
+        }
+
+        auto& batched_input = m_batched_inputs[input_port.first];
+        auto& batch = batched_input.tensor;
+        const bool reusable = batch && batch->get_element_type() == first->get_element_type() &&
+                              batch->get_shape() == batched_shape;
+        if (is_contiguous) {
+            // the samples already form a batch in the user memory, so it is passed to the graph as is
+            if (!reusable || !batched_input.is_view || batch->data() != base_ptr) {
+                batch = {ov::make_tensor(first->get_element_type(), batched_shape, base_ptr), nullptr};
+                batched_input.is_view = true;
+            }
+        } else {
+            if (!reusable || batched_input.is_view) {
+                batch = {ov::make_tensor(first->get_element_type(), batched_shape), nullptr};
+                batched_input.is_view = false;
+            }
+            auto* dst = static_cast<uint8_t*>(batch->data());
+            parallel_for(tensors.size(), [&](size_t i) {
+                cpu_memcpy(dst + i * sample_size, tensors[i]->data(), sample_size);
+            });
+        }
+        get_tensor_ptr(input_port.second) = batch;
+    }
+}
+
 void SyncInferRequest::update_external_tensor_ptrs() {
     // Update it due to batched_tensors case will update input tensor
     for (const auto& input : m_input_ports_map) {
@@ -116,7 +164,7 @@ void SyncInferRequest::infer() {
         return;
     }
 
-    convert_batched_tensors();
+    assemble_batched_inputs();
     if (!m_batched_tensors.empty()) {
         // batched_tensors will be updated for each infer, external_ptr should be update together
         update_external_tensor_ptrs();
@@ -137,7 +185,8 @@ void SyncInferRequest::infer() {
 
     push_input_data(graph);
 
-    graph.Infer(this);
+    // the states are updated regardless of the outputs, so the whole graph is executed for the stateful models
+    graph.Infer(this, m_memory_states.empty() ? m_required_outputs : std::vector<size_t>{});
 
     throw_if_canceled();
 
@@ -330,6 +379,23 @@ std::vector<ov::SoPtr<ov::IVariableState>> SyncInferRequest::query_state() const
     return {m_memory_states.begin(), m_memory_states.end()};
 }
 
+void SyncInferRequest::set_required_outputs(const std::vector<ov::Output<const ov::Node>>& ports) {
+    std::vector<size_t> required_outputs;
+    required_outputs.reserve(ports.size());
+    for (const auto& port : ports) {
+        auto found_port = find_port(port);
+        OPENVINO_ASSERT(found_port.found() && found_port.is_output(), "Cannot find output port ", port);
+        required_outputs.push_back(found_port.idx);
+    }
+    std::sort(required_outputs.begin(), required_outputs.end());
+    required_outputs.erase(std::unique(required_outputs.begin(), required_outputs.end()), required_outputs.end());
+    // all the outputs are required, so there is nothing to skip
+    if (required_outputs.size() == get_outputs().size()) {
+        required_outputs.clear();
+    }
+    m_required_outputs = std::move(required_outputs);
+}
+
 void SyncInferRequest::set_async_request(AsyncInferRequest* asyncRequest) {
     m_asyncRequest = asyncRequest;
 }
@@ -473,7 +539,7 @@ void SyncInferRequest::set_tensor(const ov::Output<const ov::Node>& in_port, con
 void SyncInferRequest::set_tensors_impl(const ov::Output<const ov::Node> port,
                                         const std::vector<ov::SoPtr<ITensor>>& tensors) {
     if (find_port(port).is_input()) {
-        m_batched_tensors[port.get_tensor_ptr()] = tensors;
+        m_batched_tensors[get_internal_port(port).get_tensor_ptr()] = tensors;
         return;
     }
     OPENVINO_THROW("Cannot find port to set_tensors!");
@@ -41,6 +41,8 @@ public:
 
     std::vector<ov::SoPtr<ov::IVariableState>> query_state() const override;
 
+    void set_required_outputs(const std::vector<ov::Output<const ov::Node>>& ports) override;
+
     void set_tensor(const ov::Output<const ov::Node>& port, const ov::SoPtr<ov::ITensor>& tensor) override;
 
     void set_tensors_impl(ov::Output<const ov::Node> port, const std::vector<ov::SoPtr<ov::ITensor>>& tensors) override;
@@ -111,6 +113,7 @@ private:
     void init_tensor(const std::size_t& port_index, const ov::ISyncInferRequest::FoundPort::Type& type);
 
     void push_input_data(Graph& graph);
+    void assemble_batched_inputs();
     void redefine_memory_for_input_nodes(Graph& graph);
     void update_external_tensor_ptrs();
     void change_default_ptr(Graph& graph);
@@ -121,11 +124,21 @@ private:
 
     std::unordered_map<std::size_t, OutputControlBlock> m_outputControlBlocks;
 
+    // Batch tensors assembled from the tensors passed via set_tensors. A batch either wraps the user memory directly
+    // (the samples are laid out back to back) or owns a buffer which is reused from one inference to another.
+    struct BatchedInput {
+        ov::SoPtr<ov::ITensor> tensor;
+        bool is_view = false;
+    };
+    std::unordered_map<std::size_t, BatchedInput> m_batched_inputs;
+
     std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_input_external_ptr;
     std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_output_external_ptr;
 
     openvino::itt::handle_t m_profiling_task = nullptr;
     std::vector<MemStatePtr> m_memory_states;
+    // sorted indices of the outputs required by the user, empty if all the outputs are required
+    std::vector<size_t> m_required_outputs;
     AsyncInferRequest* m_asyncRequest = nullptr;
     CompiledModelHolder m_compiled_model;
 
@@ -128,4 +128,49 @@ static constexpr Property<CacheQuantMode, PropertyMutability::RW> value_cache_qu
  */
 static constexpr Property<bool, PropertyMutability::RW> enable_tensor_parallel{"ENABLE_TENSOR_PARALLEL"};
 
+/**
+ * @brief Defer the primitives creation and the constants execution of the conditional subgraphs (e.g. If bodies)
+ * until the first execution of the subgraph, so the branches which are never taken cost neither compilation time
+ * nor memory for the repacked weights.
+ */
+static constexpr Property<bool, PropertyMutability::RW> lazy_subgraph_activation{"LAZY_SUBGRAPH_ACTIVATION"};
+
+/**
+ * @brief Path to the executor tuning database. If set, the nodes which have several suitable executor
+ * implementations benchmark them for the given shapes and use the fastest one. The results are stored in the file
+ * and reused by the following compilations, including the ones in other processes.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> executor_tuning_db{"EXECUTOR_TUNING_DB"};
+
+/**
+ * @brief Fuse the LM head MatMul with the following greedy search / sampling (TopK, Softmax, Multinomial) into one
+ * node, so the logits are not written and reread. Off by default.
+ */
+static constexpr Property<bool, PropertyMutability::RW> lm_head_sampling_fusion{"LM_HEAD_SAMPLING_FUSION"};
+
+/**
+ * @brief Keep the Select nodes with a single element condition out of fusion and tokenization, so a static graph
+ * can skip the nodes computed only for the branch which is not taken. Off by default.
+ */
+static constexpr Property<bool, PropertyMutability::RW> early_exit{"EARLY_EXIT"};
+
+/**
+ * @brief Number of the first tokens (attention sinks) which are always kept in the stateful KV-cache of
+ * ScaledDotProductAttention when the sliding window is enabled by kv_cache_window_size.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> kv_cache_sink_size{"KV_CACHE_SINK_SIZE"};
+
+/**
+ * @brief Number of the latest tokens kept in the stateful KV-cache of ScaledDotProductAttention in addition to the
+ * attention sinks. The older tokens are evicted, so the cache size and the per-token latency stay constant for
+ * sequences of any length. 0 (default) means the cache is not bounded.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> kv_cache_window_size{"KV_CACHE_WINDOW_SIZE"};
+
+/**
+ * @brief RoPE base used to move the positions of the attention sink keys next to the window when tokens are evicted
+ * from the bounded KV-cache. 0 disables the re-rotation, e.g. for the models without rotary embeddings.
+ */
+static constexpr Property<float, PropertyMutability::RW> kv_cache_rope_theta{"KV_CACHE_ROPE_THETA"};
+
 }  // namespace ov::intel_cpu
@@ -36,6 +36,27 @@ using namespace ov::Extensions::Cpu::XARCH;
 
 namespace ov::intel_cpu {
 
+namespace {
+// Read-only tensor sharing the memory block with the variable state it was taken from
+class StateSnapshotTensor : public Tensor {
+public:
+    using Tensor::Tensor;
+    using Tensor::data;
+
+    void set_shape([[maybe_unused]] ov::Shape shape) override {
+        OPENVINO_THROW("Can not change the shape of the variable state snapshot");
+    }
+
+    [[noreturn]] void* data() override {
+        OPENVINO_THROW("Can not access non-const pointer of the variable state snapshot");
+    }
+
+    [[noreturn]] void* data([[maybe_unused]] const element::Type& type) override {
+        OPENVINO_THROW("Can not access non-const pointer of the variable state snapshot");
+    }
+};
+}  // namespace
+
 VariableStateBase::VariableStateBase(const std::string& name, MemoryDescPtr external_desc)
     : IVariableState{name},
       m_external_desc{std::move(external_desc)} {}
@@ -68,7 +89,8 @@ void VariableStateBase::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
         input_mem()->redefineDesc(new_desc);
     }
 
-    auto* src = state->data();
+    // the state may be a read-only tensor, it's only read by the load
+    auto* src = const_cast<void*>(std::as_const(*state).data());
 
     Memory mem(get_engine(), state_desc, src);
     input_mem()->load(mem, true, false);
@@ -131,8 +153,10 @@ void VariableStateBase::commit() {
 VariableStateDoubleBuffer::VariableStateDoubleBuffer(const std::string& name,
                                                      const MemoryPtr& first_buffer,
                                                      const MemoryPtr& second_buffer,
-                                                     const MemoryDescPtr& external_desc)
-    : VariableStateBase(name, external_desc) {
+                                                     const MemoryDescPtr& external_desc,
+                                                     bool share_snapshots)
+    : VariableStateBase(name, external_desc),
+      m_share_snapshots(share_snapshots) {
     OPENVINO_ASSERT(first_buffer && second_buffer);
     reset_prime_mem(first_buffer);
     reset_second_mem(second_buffer);
@@ -149,18 +173,60 @@ VariableStateDoubleBuffer::VariableStateDoubleBuffer(const std::string& name,
     }
 }
 
+ov::SoPtr<ov::ITensor> VariableStateDoubleBuffer::snapshot() {
+    const auto& mem = prime_mem();
+    auto current_ext_desc = get_external_desc()->cloneWithNewDims(mem->getStaticDims());
+    // the reset state may be overwritten in place by the init subgraph, so it's always copied
+    if (!m_share_snapshots || is_reset_state() || !current_ext_desc->isCompatible(*mem->getDescPtr())) {
+        return VariableStateBase::snapshot();
+    }
+
+    // The graph only reads the prime buffer, and a shared buffer is replaced before it's updated,
+    // so the snapshot may share the memory block instead of copying the whole state
+    m_shared[buffer_num] = true;
+    return std::make_shared<StateSnapshotTensor>(
+        std::make_shared<Memory>(get_engine(), mem->getDescPtr(), mem->getMemoryBlock()));
+}
+
+void VariableStateDoubleBuffer::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
+    auto snapshot = std::dynamic_pointer_cast<StateSnapshotTensor>(state._ptr);
+    if (snapshot && m_share_snapshots) {
+        auto mem = snapshot->get_memory();
+        if (mem->getDesc().isCompatible(*m_internal_desc->cloneWithNewDims(mem->getStaticDims()))) {
+            reset_prime_mem(std::make_shared<Memory>(get_engine(), mem->getDescPtr(), mem->getMemoryBlock()));
+            m_shared[buffer_num] = true;
+            return;
+        }
+    }
+
+    unshare(buffer_num);
+    VariableStateBase::set_state_impl(state);
+}
+
+void VariableStateDoubleBuffer::unshare(size_t idx) {
+    if (!m_shared[idx]) {
+        return;
+    }
+    auto& mem = m_internal_mem[idx];
+    mem = std::make_shared<Memory>(get_engine(), mem->getDescPtr());
+    m_shared[idx] = false;
+}
+
 void VariableStateDoubleBuffer::reset_impl() {
     auto new_desc = to_static(m_internal_desc);
-    for (auto&& mem : m_internal_mem) {
-        if (mem) {
-            mem->redefineDesc(new_desc);
-            mem->nullify();
+    for (size_t i = 0; i < m_internal_mem.size(); i++) {
+        if (m_internal_mem[i]) {
+            unshare(i);
+            m_internal_mem[i]->redefineDesc(new_desc);
+            m_internal_mem[i]->nullify();
         }
     }
 }
 
 void VariableStateDoubleBuffer::commit_impl() {
     buffer_num ^= 0x01;
+    // the second buffer is going to be overwritten by the next inference
+    unshare(buffer_num ^ 0x01);
 }
 
 MemoryPtr VariableStateDoubleBuffer::input_mem() {
@@ -290,22 +356,24 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
             });
         } else {
             parallel_for3d(L0, B, H, [&](size_t ithr, size_t m, size_t b, size_t h) {
-                auto b_kv = static_cast<size_t>(beam_table.at<int32_t>({b, m}));
+                auto slot = m_window.slot(m);
+                auto b_kv = static_cast<size_t>(beam_table.at<int32_t>({b, slot}));
                 buffers[ithr].resize<float>({S});
                 for (size_t group_id = 0; group_id < S / m_group_size; group_id++) {
-                    attn_dequant_u8(pastkv.ptr<uint8_t>(m, b_kv, h, group_id * m_group_size),
+                    attn_dequant_u8(pastkv.ptr<uint8_t>(slot, b_kv, h, group_id * m_group_size),
                                     buffers[ithr].ptr<float>() + group_id * m_group_size,
                                     m_group_size,
-                                    m_scale_zp.ptr<float>(m, b_kv, h, group_id * 2)[0],
-                                    m_scale_zp.ptr<float>(m, b_kv, h, group_id * 2)[1]);
+                                    m_scale_zp.ptr<float>(slot, b_kv, h, group_id * 2)[0],
+                                    m_scale_zp.ptr<float>(slot, b_kv, h, group_id * 2)[1]);
                 }
                 cpu_convert(buffers[ithr].ptr<float>(), output.ptr_v(m, b, h), element::f32, output.m_dt, S);
             });
         }
     } else {
         parallel_for3d(L0, B, H, [&](size_t m, size_t b, size_t h) {
-            auto b_kv = static_cast<size_t>(beam_table.at<int32_t>({b, m}));
-            cpu_convert(pastkv.ptr_v(m, b_kv, h), output.ptr_v(m, b, h), pastkv.m_dt, output.m_dt, S);
+            auto slot = m_window.slot(m);
+            auto b_kv = static_cast<size_t>(beam_table.at<int32_t>({b, slot}));
+            cpu_convert(pastkv.ptr_v(slot, b_kv, h), output.ptr_v(m, b, h), pastkv.m_dt, output.m_dt, S);
         });
     }
 
@@ -395,10 +463,19 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
     }
     m_internal_mem_max_size = dense_internal_desc->getCurrentMemSize() / dense_internal_desc->getPrecision().size();
     m_hidden_state_max_size = mem_desc->getCurrentMemSize() / mem_desc->getPrecision().size();
+
+    // the state is linear, the positions of the sink keys are taken as they are
+    reset_window_state();
 }
 
 void VariableStateKVcache::reset_impl() {
-    // nothing to do
+    reset_window_state();
+}
+
+void VariableStateKVcache::reset_window_state() {
+    m_window.ring_offset = 0;
+    m_window.evicted = 0;
+    m_window.sink_keys = PlainTensor();
 }
 
 void VariableStateKVcache::commit_impl() {
@@ -66,7 +66,11 @@ public:
     VariableStateDoubleBuffer(const std::string& name,
                               const MemoryPtr& first_buffer,
                               const MemoryPtr& second_buffer,
-                              const MemoryDescPtr& external_desc);
+                              const MemoryDescPtr& external_desc,
+                              bool share_snapshots = false);
+
+    // ov::IVariableState
+    ov::SoPtr<ov::ITensor> snapshot() override;
 
     MemoryPtr input_mem() override;
     MemoryPtr output_mem() override;
@@ -74,9 +78,13 @@ public:
 
 private:
     // ov::intel_cpu::VariableStateBase
+    void set_state_impl(const ov::SoPtr<ov::ITensor>& state) override;
     void reset_impl() override;
     void commit_impl() override;
 
+    // replaces the buffer shared with the state snapshots by a new one, the data is not preserved
+    void unshare(size_t idx);
+
     void reset_prime_mem(const MemoryPtr& mem) {
         m_internal_mem[buffer_num] = mem;
     }
@@ -97,7 +105,9 @@ private:
 
     MemoryDescPtr m_internal_desc;  // mem desc required by the graph internal tensor
     std::array<MemoryPtr, 2> m_internal_mem{};
+    std::array<bool, 2> m_shared{};  // the buffer memory block is referenced by the state snapshots
     size_t buffer_num = 0;
+    bool m_share_snapshots = false;  // the graph never modifies the prime buffer, so the snapshots may reference it
 };
 
 class VariableStateSingleBuffer : public VariableStateBase {
@@ -162,11 +172,29 @@ public:
         m_scale_zp = t;
     }
 
+    // bookkeeping of the bounded cache (attention sinks + sliding window) of ScaledDotProductAttention:
+    // the window tokens are kept in a ring after the sink tokens once the cache is full
+    struct WindowState {
+        size_t sink = 0;
+        size_t window = 0;
+        size_t ring_offset = 0;  // slot of the oldest window token relative to the first window slot
+        size_t evicted = 0;      // number of the tokens evicted since the state was reset or set
+        PlainTensor sink_keys;   // f32 [B, H, sink, S] the sink keys in their original positions
+        // maps the logical token index to the slot of the cache
+        size_t slot(size_t m) const {
+            return (m < sink || ring_offset == 0) ? m : sink + (m - sink + ring_offset) % window;
+        }
+    };
+    WindowState& window_state() {
+        return m_window;
+    }
+
 private:
     // ov::intel_cpu::VariableStateBase
     void set_state_impl(const ov::SoPtr<ov::ITensor>& state) override;
     void reset_impl() override;
     void commit_impl() override;
+    void reset_window_state();
 
     MemoryPtr m_internal_mem;  // kv cache
     MemoryPtr m_hidden_state;  // beam access table
@@ -180,6 +208,7 @@ private:
     PlainTensor m_scale_zp;
     bool m_quant_by_channel = false;
     size_t m_group_size = 0;
+    WindowState m_window;
 };
 
 using MemStatePtr = std::shared_ptr<IVariableState>;
@@ -307,20 +307,23 @@ ColorConvert::Converter::PrimitiveDescs supportedPrimitiveDescs(Node* node) {
 
     const ov::element::Type precision =
         node->getOriginalInputPrecisionAtPort(0) == ov::element::u8 ? ov::element::u8 : ov::element::f32;
+    // u8 planes may be converted straight to f32 when the preceding Convert has been merged into the node
+    const ov::element::Type outPrecision =
+        node->getOriginalOutputPrecisionAtPort(0) == ov::element::f32 ? ov::element::f32 : precision;
 
     ColorConvert::Converter::PrimitiveDescs descs;
 
     descs.emplace_back(std::vector<PortConfigurator>{node->getOriginalInputsNumber(), {layout, precision}},
-                       std::vector<PortConfigurator>{{layout, precision}},
+                       std::vector<PortConfigurator>{{layout, outPrecision}},
                        mayiuse(cpu_isa_t::sse41) ? impl_desc_type::jit_uni : impl_desc_type::ref,
                        true);
 
     return descs;
 }
 
-template <typename T, impl_desc_type I>
+template <typename T, typename TO, impl_desc_type I>
 class SinglePlaneConvert;
-template <typename T, impl_desc_type I>
+template <typename T, typename TO, impl_desc_type I>
 class TwoPlaneConvert;
 
 class RefConverter : public Converter {
@@ -328,10 +331,10 @@ public:
     RefConverter(Node* node);
 
 protected:
-    template <typename T>
+    template <typename T, typename TO>
     void convert(const T* y,
                  const T* uv,
-                 T* dst,
+                 TO* dst,
                  size_t batch_size,
                  size_t height,
                  size_t width,
@@ -345,17 +348,17 @@ RefConverter::RefConverter(Node* node) : Converter(node) {
     OPENVINO_ASSERT(node->getOriginalOutputsNumber(), "NV12Converter node has incorrect number of outputs");
 }
 
-template <typename T>
+template <typename T, typename TO>
 void RefConverter::convert(const T* y,
                            const T* uv,
-                           T* dst,
+                           TO* dst,
                            size_t batch_size,
                            size_t height,
                            size_t width,
                            size_t stride_y,
                            size_t stride_uv) {
     ov::parallel_for2d(batch_size, height, [&](int batch, int h) {
-        T* out = dst + batch * width * height * 3;
+        TO* out = dst + batch * width * height * 3;
         auto y_ptr = y + batch * stride_y;
         auto uv_ptr = uv + batch * stride_uv;
 
@@ -365,10 +368,10 @@ void RefConverter::convert(const T* y,
             auto uv_index = (h / 2) * width + (w / 2) * 2;
             auto u_val = static_cast<float>(uv_ptr[uv_index]);
             auto v_val = static_cast<float>(uv_ptr[uv_index + 1]);
-            T r;
-            T g;
-            T b;
-            std::tie(r, g, b) = yuv_to_rgb<T>(y_val, u_val, v_val);
+            TO r;
+            TO g;
+            TO b;
+            std::tie(r, g, b) = yuv_to_rgb<TO>(y_val, u_val, v_val);
             out[y_index * 3 + _colorFormat[0]] = r;
             out[y_index * 3 + _colorFormat[1]] = g;
             out[y_index * 3 + _colorFormat[2]] = b;
@@ -376,8 +379,8 @@ void RefConverter::convert(const T* y,
     });
 }
 
-template <typename T>
-class SinglePlaneConvert<T, impl_desc_type::ref> : public RefConverter {
+template <typename T, typename TO>
+class SinglePlaneConvert<T, TO, impl_desc_type::ref> : public RefConverter {
 public:
     using RefConverter::RefConverter;
 
@@ -390,14 +393,14 @@ public:
 
         const T* y = static_cast<const T*>(input(0));
         const T* uv = y + width * height;
-        T* dst = static_cast<T*>(output(0));
+        TO* dst = static_cast<TO*>(output(0));
 
-        convert<T>(y, uv, dst, batch_size, height, width, height * width * 3 / 2, height * width * 3 / 2);
+        convert<T, TO>(y, uv, dst, batch_size, height, width, height * width * 3 / 2, height * width * 3 / 2);
     }
 };
 
-template <typename T>
-class TwoPlaneConvert<T, impl_desc_type::ref> : public RefConverter {
+template <typename T, typename TO>
+class TwoPlaneConvert<T, TO, impl_desc_type::ref> : public RefConverter {
 public:
     using RefConverter::RefConverter;
 
@@ -406,22 +409,22 @@ public:
 
         const T* y = static_cast<const T*>(input(0));
         const T* uv = static_cast<const T*>(input(1));
-        T* dst = static_cast<T*>(output(0));
+        TO* dst = static_cast<TO*>(output(0));
 
         const size_t batch_size = dims[N_DIM];
         const size_t height = dims[H_DIM];
         const size_t width = dims[W_DIM];
 
-        convert<T>(y, uv, dst, batch_size, height, width, height * width, height * width / 2);
+        convert<T, TO>(y, uv, dst, batch_size, height, width, height * width, height * width / 2);
     }
 };
 
 #if defined(OPENVINO_ARCH_X86_64)
-template <typename T>
+template <typename T, typename TO>
 class JitConverter;
 
-template <typename T, size_t N>
-class JitConverter<T[N]> : public jit_uni_converter {
+template <typename T, typename TO, size_t N>
+class JitConverter<T[N], TO> : public jit_uni_converter {
 private:
     void generate() override;
     std::tuple<variable<float[N]>, variable<float[N]>, variable<float[N]>> load_yuv(const variable<const T*>& src_y,
@@ -429,14 +432,14 @@ private:
     std::tuple<variable<float[N]>, variable<float[N]>> unpack_uv(const variable<float[N]>& uv);
 };
 
-template <typename T, size_t N>
-void JitConverter<T[N]>::generate() {
+template <typename T, typename TO, size_t N>
+void JitConverter<T[N], TO>::generate() {
     preamble();
 
     // Get arguments addresses
     auto src_y = arg<const T*>(&Params::y);
     auto src_uv = arg<const T*>(&Params::u);
-    auto dst = arg<T*>(&Params::dst);
+    auto dst = arg<TO*>(&Params::dst);
     auto width = arg(&Params::width);
     auto colorFormat = arg(&Params::colorFormat);
 
@@ -444,7 +447,7 @@ void JitConverter<T[N]>::generate() {
     _consts = data;
 
     const auto reg_capacity_log = static_cast<size_t>(std::logb(N));
-    const size_t step = N * sizeof(T);
+    const size_t step = N * sizeof(TO);
 
     width >>= reg_capacity_log;
 
@@ -456,7 +459,7 @@ void JitConverter<T[N]>::generate() {
         const auto& u = std::get<1>(yuv);
         const auto& v = std::get<2>(yuv);
 
-        yuv_to_rgb(y, u, v, colorFormat, std::is_integral<T>::value);
+        yuv_to_rgb(y, u, v, colorFormat, std::is_integral<TO>::value);
 
         store(dst, y);
         dst += step;
@@ -483,7 +486,7 @@ void JitConverter<T[N]>::generate() {
         const auto& u = std::get<0>(uv_pair);
         const auto& v = std::get<1>(uv_pair);
 
-        yuv_to_rgb(y, u, v, colorFormat, std::is_integral<T>::value);
+        yuv_to_rgb(y, u, v, colorFormat, std::is_integral<TO>::value);
 
         store_tail(dst, y, u, v, width);
     });
@@ -491,9 +494,9 @@ void JitConverter<T[N]>::generate() {
     postamble();
 }
 
-template <typename T, size_t N>
+template <typename T, typename TO, size_t N>
 std::tuple<jit_kernel::variable<float[N]>, jit_kernel::variable<float[N]>, jit_kernel::variable<float[N]>>
-JitConverter<T[N]>::load_yuv(const variable<const T*>& src_y, const variable<const T*>& src_uv) {
+JitConverter<T[N], TO>::load_yuv(const variable<const T*>& src_y, const variable<const T*>& src_uv) {
     auto y = var<float[N]>();
     auto uv = var<float[N]>();
 
@@ -508,8 +511,8 @@ JitConverter<T[N]>::load_yuv(const variable<const T*>& src_y, const variable<con
     return std::make_tuple(std::move(y), std::move(std::get<0>(uv_pair)), std::move(std::get<1>(uv_pair)));
 }
 
-template <typename T, size_t N>
-std::tuple<jit_kernel::variable<float[N]>, jit_kernel::variable<float[N]>> JitConverter<T[N]>::unpack_uv(
+template <typename T, typename TO, size_t N>
+std::tuple<jit_kernel::variable<float[N]>, jit_kernel::variable<float[N]>> JitConverter<T[N], TO>::unpack_uv(
     const variable<float[N]>& uv) {
     auto u = var<float[N]>();
     auto v = var<float[N]>();
@@ -523,21 +526,21 @@ std::tuple<jit_kernel::variable<float[N]>, jit_kernel::variable<float[N]>> JitCo
     return std::make_tuple(std::move(u), std::move(v));
 }
 
-template <typename T>
+template <typename T, typename TO>
 const jit_uni_converter& jit_converter_create() {
     auto createKernel = []() {
         std::unique_ptr<jit_uni_converter> kernel;
 
         if (mayiuse(cpu_isa_t::avx512_core)) {
-            auto converter = new JitConverter<T[16]>;
+            auto converter = new JitConverter<T[16], TO>;
             kernel.reset(converter);
             converter->init();
         } else if (mayiuse(cpu_isa_t::avx2)) {
-            auto converter = new JitConverter<T[8]>;
+            auto converter = new JitConverter<T[8], TO>;
             kernel.reset(converter);
             converter->init();
         } else if (mayiuse(cpu_isa_t::sse41)) {
-            auto converter = new JitConverter<T[4]>;
+            auto converter = new JitConverter<T[4], TO>;
             kernel.reset(converter);
             converter->init();
         } else {
@@ -552,20 +555,20 @@ const jit_uni_converter& jit_converter_create() {
     return *kernel;
 }
 
-template <typename T>
+template <typename T, typename TO>
 const jit_uni_converter& jit_converter_get() {
-    return jit_converter_create<T>();
+    return jit_converter_create<T, TO>();
 }
 
-template <typename T>
-class SinglePlaneConvert<T, impl_desc_type::jit_uni> : public Converter {
+template <typename T, typename TO>
+class SinglePlaneConvert<T, TO, impl_desc_type::jit_uni> : public Converter {
 public:
     SinglePlaneConvert(Node* node) : Converter(node) {
-        jit_converter_create<T>();
+        jit_converter_create<T, TO>();
     }
 
     void execute([[maybe_unused]] const dnnl::stream& strm) override {
-        const auto& kernel = jit_converter_get<T>();
+        const auto& kernel = jit_converter_get<T, TO>();
         const auto& dims = inputDims(0);
 
         const size_t batch_size = dims[N_DIM];
@@ -574,7 +577,7 @@ public:
 
         const T* y = static_cast<const T*>(input(0));
         const T* uv = y + width * height;
-        T* dst = static_cast<T*>(output(0));
+        TO* dst = static_cast<TO*>(output(0));
 
         const size_t stride_y = height * width * 3 / 2;
         const size_t stride_uv = height * width * 3 / 2;
@@ -593,15 +596,15 @@ public:
     }
 };
 
-template <typename T>
-class TwoPlaneConvert<T, impl_desc_type::jit_uni> : public Converter {
+template <typename T, typename TO>
+class TwoPlaneConvert<T, TO, impl_desc_type::jit_uni> : public Converter {
 public:
     TwoPlaneConvert(Node* node) : Converter(node) {
-        jit_converter_create<T>();
+        jit_converter_create<T, TO>();
     }
 
     void execute([[maybe_unused]] const dnnl::stream& strm) override {
-        const auto& kernel = jit_converter_get<T>();
+        const auto& kernel = jit_converter_get<T, TO>();
         const auto& dims = inputDims(0);
 
         const size_t batch_size = dims[N_DIM];
@@ -610,7 +613,7 @@ public:
 
         const T* y = static_cast<const T*>(input(0));
         const T* uv = static_cast<const T*>(input(1));
-        T* dst = static_cast<T*>(output(0));
+        TO* dst = static_cast<TO*>(output(0));
 
         const size_t stride_y = height * width;
         const size_t stride_uv = height * width / 2;
@@ -639,20 +642,23 @@ ColorConvert::Converter::PrimitiveDescs supportedPrimitiveDescs(Node* node) {
 
     const ov::element::Type precision =
         node->getOriginalInputPrecisionAtPort(0) == ov::element::u8 ? ov::element::u8 : ov::element::f32;
+    // u8 planes may be converted straight to f32 when the preceding Convert has been merged into the node
+    const ov::element::Type outPrecision =
+        node->getOriginalOutputPrecisionAtPort(0) == ov::element::f32 ? ov::element::f32 : precision;
 
     ColorConvert::Converter::PrimitiveDescs descs;
 
     descs.emplace_back(std::vector<PortConfigurator>{node->getOriginalInputsNumber(), {layout, precision}},
-                       std::vector<PortConfigurator>{{layout, precision}},
+                       std::vector<PortConfigurator>{{layout, outPrecision}},
                        mayiuse(cpu_isa_t::sse41) ? impl_desc_type::jit_uni : impl_desc_type::ref,
                        true);
 
     return descs;
 }
 
-template <typename T, impl_desc_type I>
+template <typename T, typename TO, impl_desc_type I>
 class SinglePlaneConvert;
-template <typename T, impl_desc_type I>
+template <typename T, typename TO, impl_desc_type I>
 class ThreePlaneConvert;
 
 class RefConverter : public Converter {
@@ -660,11 +666,11 @@ public:
     RefConverter(Node* node);
 
 protected:
-    template <typename T>
+    template <typename T, typename TO>
     void convert(const T* y,
                  const T* u,
                  const T* v,
-                 T* dst,
+                 TO* dst,
                  size_t batch_size,
                  size_t height,
                  size_t width,
@@ -678,18 +684,18 @@ RefConverter::RefConverter(Node* node) : Converter(node) {
     OPENVINO_ASSERT(node->getOriginalOutputsNumber(), "I420Converter node has incorrect number of outputs");
 }
 
-template <typename T>
+template <typename T, typename TO>
 void RefConverter::convert(const T* y,
                            const T* u,
                            const T* v,
-                           T* dst,
+                           TO* dst,
                            size_t batch_size,
                            size_t height,
                            size_t width,
                            size_t stride_y,
                            size_t stride_uv) {
     ov::parallel_for2d(batch_size, height, [&](int batch, int h) {
-        T* out = dst + batch * width * height * 3;
+        TO* out = dst + batch * width * height * 3;
         auto y_ptr = y + batch * stride_y;
         auto u_ptr = u + batch * stride_uv;
         auto v_ptr = v + batch * stride_uv;
@@ -700,10 +706,10 @@ void RefConverter::convert(const T* y,
             auto uv_index = (h / 2) * (width / 2) + w / 2;
             auto u_val = static_cast<float>(u_ptr[uv_index]);
             auto v_val = static_cast<float>(v_ptr[uv_index]);
-            T r;
-            T g;
-            T b;
-            std::tie(r, g, b) = yuv_to_rgb<T>(y_val, u_val, v_val);
+            TO r;
+            TO g;
+            TO b;
+            std::tie(r, g, b) = yuv_to_rgb<TO>(y_val, u_val, v_val);
             out[y_index * 3 + _colorFormat[0]] = r;
             out[y_index * 3 + _colorFormat[1]] = g;
             out[y_index * 3 + _colorFormat[2]] = b;
@@ -711,8 +717,8 @@ void RefConverter::convert(const T* y,
     });
 }
 
-template <typename T>
-class SinglePlaneConvert<T, impl_desc_type::ref> : public RefConverter {
+template <typename T, typename TO>
+class SinglePlaneConvert<T, TO, impl_desc_type::ref> : public RefConverter {
 public:
     using RefConverter::RefConverter;
 
@@ -726,14 +732,14 @@ public:
         const T* y = static_cast<const T*>(input(0));
         const T* u = y + width * height;
         const T* v = y + 5 * width * height / 4;
-        T* dst = static_cast<T*>(output(0));
+        TO* dst = static_cast<TO*>(output(0));
 
-        convert<T>(y, u, v, dst, batch_size, height, width, height * width * 3 / 2, height * width * 3 / 2);
+        convert<T, TO>(y, u, v, dst, batch_size, height, width, height * width * 3 / 2, height * width * 3 / 2);
     }
 };
 
-template <typename T>
-class ThreePlaneConvert<T, impl_desc_type::ref> : public RefConverter {
+template <typename T, typename TO>
+class ThreePlaneConvert<T, TO, impl_desc_type::ref> : public RefConverter {
 public:
     using RefConverter::RefConverter;
 
@@ -743,22 +749,22 @@ public:
         const T* y = static_cast<const T*>(input(0));
         const T* u = static_cast<const T*>(input(1));
         const T* v = static_cast<const T*>(input(2));
-        T* dst = static_cast<T*>(output(0));
+        TO* dst = static_cast<TO*>(output(0));
 
         const size_t batch_size = dims[N_DIM];
         const size_t height = dims[H_DIM];
         const size_t width = dims[W_DIM];
 
-        convert<T>(y, u, v, dst, batch_size, height, width, height * width, height * width / 4);
+        convert<T, TO>(y, u, v, dst, batch_size, height, width, height * width, height * width / 4);
     }
 };
 
 #if defined(OPENVINO_ARCH_X86_64)
-template <typename T>
+template <typename T, typename TO>
 class JitConverter;
 
-template <typename T, size_t N>
-class JitConverter<T[N]> : public jit_uni_converter {
+template <typename T, typename TO, size_t N>
+class JitConverter<T[N], TO> : public jit_uni_converter {
 private:
     void generate() override;
     std::tuple<variable<float[N]>, variable<float[N]>, variable<float[N]>> load_yuv(const variable<const T*>& src_y,
@@ -767,15 +773,15 @@ private:
     void unpack_uv(const variable<float[N]>& u, const variable<float[N]>& v);
 };
 
-template <typename T, size_t N>
-void JitConverter<T[N]>::generate() {
+template <typename T, typename TO, size_t N>
+void JitConverter<T[N], TO>::generate() {
     preamble();
 
     // Get arguments addresses
     auto src_y = arg<const T*>(&Params::y);
     auto src_u = arg<const T*>(&Params::u);
     auto src_v = arg<const T*>(&Params::v);
-    auto dst = arg<T*>(&Params::dst);
+    auto dst = arg<TO*>(&Params::dst);
     auto width = arg(&Params::width);
     auto colorFormat = arg(&Params::colorFormat);
 
@@ -783,7 +789,7 @@ void JitConverter<T[N]>::generate() {
     _consts = data;
 
     const auto reg_capacity_log = static_cast<size_t>(std::logb(N));
-    const size_t step = N * sizeof(T);
+    const size_t step = N * sizeof(TO);
 
     width >>= reg_capacity_log;
 
@@ -795,7 +801,7 @@ void JitConverter<T[N]>::generate() {
         const auto& u = std::get<1>(yuv);
         const auto& v = std::get<2>(yuv);
 
-        yuv_to_rgb(y, u, v, colorFormat, std::is_integral<T>::value);
+        yuv_to_rgb(y, u, v, colorFormat, std::is_integral<TO>::value);
 
         store(dst, y);
         dst += step;
@@ -822,7 +828,7 @@ void JitConverter<T[N]>::generate() {
 
         unpack_uv(u, v);
 
-        yuv_to_rgb(y, u, v, colorFormat, std::is_integral<T>::value);
+        yuv_to_rgb(y, u, v, colorFormat, std::is_integral<TO>::value);
 
         store_tail(dst, y, u, v, width);
     });
@@ -830,11 +836,11 @@ void JitConverter<T[N]>::generate() {
     postamble();
 }
 
-template <typename T, size_t N>
+template <typename T, typename TO, size_t N>
 std::tuple<jit_kernel::variable<float[N]>, jit_kernel::variable<float[N]>, jit_kernel::variable<float[N]>>
-JitConverter<T[N]>::load_yuv(const variable<const T*>& src_y,
-                             const variable<const T*>& src_u,
-                             const variable<const T*>& src_v) {
+JitConverter<T[N], TO>::load_yuv(const variable<const T*>& src_y,
+                                 const variable<const T*>& src_u,
+                                 const variable<const T*>& src_v) {
     auto y = var<float[N]>();
     auto u = var<float[N]>();
     auto v = var<float[N]>();
@@ -852,28 +858,28 @@ JitConverter<T[N]>::load_yuv(const variable<const T*>& src_y,
     return std::make_tuple(std::move(y), std::move(u), std::move(v));
 }
 
-template <typename T, size_t N>
-void JitConverter<T[N]>::unpack_uv(const variable<float[N]>& u, const variable<float[N]>& v) {
+template <typename T, typename TO, size_t N>
+void JitConverter<T[N], TO>::unpack_uv(const variable<float[N]>& u, const variable<float[N]>& v) {
     static const uint8_t order[] = {0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7};
     u = u.permute(order);
     v = v.permute(order);
 }
 
-template <typename T>
+template <typename T, typename TO>
 const jit_uni_converter& jit_converter_create() {
     auto createKernel = []() {
         std::unique_ptr<jit_uni_converter> kernel;
 
         if (mayiuse(cpu_isa_t::avx512_core)) {
-            auto converter = new JitConverter<T[16]>;
+            auto converter = new JitConverter<T[16], TO>;
             kernel.reset(converter);
             converter->init();
         } else if (mayiuse(cpu_isa_t::avx2)) {
-            auto converter = new JitConverter<T[8]>;
+            auto converter = new JitConverter<T[8], TO>;
             kernel.reset(converter);
             converter->init();
         } else if (mayiuse(cpu_isa_t::sse41)) {
-            auto converter = new JitConverter<T[4]>;
+            auto converter = new JitConverter<T[4], TO>;
             kernel.reset(converter);
             converter->init();
         } else {
@@ -888,20 +894,20 @@ const jit_uni_converter& jit_converter_create() {
     return *kernel;
 }
 
-template <typename T>
+template <typename T, typename TO>
 const jit_uni_converter& jit_converter_get() {
-    return jit_converter_create<T>();
+    return jit_converter_create<T, TO>();
 }
 
-template <typename T>
-class SinglePlaneConvert<T, impl_desc_type::jit_uni> : public Converter {
+template <typename T, typename TO>
+class SinglePlaneConvert<T, TO, impl_desc_type::jit_uni> : public Converter {
 public:
     SinglePlaneConvert(Node* node) : Converter(node) {
-        jit_converter_create<T>();
+        jit_converter_create<T, TO>();
     }
 
     void execute([[maybe_unused]] const dnnl::stream& strm) override {
-        const auto& kernel = jit_converter_get<T>();
+        const auto& kernel = jit_converter_get<T, TO>();
         const auto& dims = inputDims(0);
 
         const size_t batch_size = dims[N_DIM];
@@ -911,7 +917,7 @@ public:
         const T* y = static_cast<const T*>(input(0));
         const T* u = y + width * height;
         const T* v = y + 5 * width * height / 4;
-        T* dst = static_cast<T*>(output(0));
+        TO* dst = static_cast<TO*>(output(0));
 
         const size_t stride_y = height * width * 3 / 2;
         const size_t stride_uv = height * width * 3 / 2;
@@ -930,21 +936,21 @@ public:
     }
 };
 
-template <typename T>
-class ThreePlaneConvert<T, impl_desc_type::jit_uni> : public Converter {
+template <typename T, typename TO>
+class ThreePlaneConvert<T, TO, impl_desc_type::jit_uni> : public Converter {
 public:
     ThreePlaneConvert(Node* node) : Converter(node) {
-        jit_converter_create<T>();
+        jit_converter_create<T, TO>();
     }
 
     void execute([[maybe_unused]] const dnnl::stream& strm) override {
-        const auto& kernel = jit_converter_get<T>();
+        const auto& kernel = jit_converter_get<T, TO>();
         const auto& dims = inputDims(0);
 
         const T* y = static_cast<const T*>(input(0));
         const T* u = static_cast<const T*>(input(1));
         const T* v = static_cast<const T*>(input(2));
-        T* dst = static_cast<T*>(output(0));
+        TO* dst = static_cast<TO*>(output(0));
 
         const size_t batch_size = dims[N_DIM];
         const size_t height = dims[H_DIM];
@@ -1046,56 +1052,88 @@ void ColorConvert::initSupportedPrimitiveDescriptors() {
 }
 
 void ColorConvert::initSupportedNV12Impls() {
-#define SUPPORTED_IMPL(Impl, type, desc_type)                         \
-    [](Node* node) {                                                  \
-        return new nv12::Impl<type, impl_desc_type::desc_type>(node); \
+#define SUPPORTED_IMPL(Impl, type, out_type, desc_type)                         \
+    [](Node* node) {                                                            \
+        return new nv12::Impl<type, out_type, impl_desc_type::desc_type>(node); \
     };
 
     // ref
     {
         auto& impls = _supportedImpls[impl_desc_type::ref][algorithm];
-        impls[ov::element::Type_t::u8][true] = SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, ref);
-        impls[ov::element::Type_t::u8][false] = SUPPORTED_IMPL(TwoPlaneConvert, uint8_t, ref);
-        impls[ov::element::Type_t::f32][true] = SUPPORTED_IMPL(SinglePlaneConvert, float, ref);
-        impls[ov::element::Type_t::f32][false] = SUPPORTED_IMPL(TwoPlaneConvert, float, ref);
+        impls[ov::element::Type_t::u8][ov::element::Type_t::u8][true] =
+            SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, uint8_t, ref);
+        impls[ov::element::Type_t::u8][ov::element::Type_t::u8][false] =
+            SUPPORTED_IMPL(TwoPlaneConvert, uint8_t, uint8_t, ref);
+        impls[ov::element::Type_t::u8][ov::element::Type_t::f32][true] =
+            SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, float, ref);
+        impls[ov::element::Type_t::u8][ov::element::Type_t::f32][false] =
+            SUPPORTED_IMPL(TwoPlaneConvert, uint8_t, float, ref);
+        impls[ov::element::Type_t::f32][ov::element::Type_t::f32][true] =
+            SUPPORTED_IMPL(SinglePlaneConvert, float, float, ref);
+        impls[ov::element::Type_t::f32][ov::element::Type_t::f32][false] =
+            SUPPORTED_IMPL(TwoPlaneConvert, float, float, ref);
     }
 
 #if defined(OPENVINO_ARCH_X86_64)
     // jit_uni
     {
         auto& impls = _supportedImpls[impl_desc_type::jit_uni][algorithm];
-        impls[ov::element::Type_t::u8][true] = SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, jit_uni);
-        impls[ov::element::Type_t::u8][false] = SUPPORTED_IMPL(TwoPlaneConvert, uint8_t, jit_uni);
-        impls[ov::element::Type_t::f32][true] = SUPPORTED_IMPL(SinglePlaneConvert, float, jit_uni);
-        impls[ov::element::Type_t::f32][false] = SUPPORTED_IMPL(TwoPlaneConvert, float, jit_uni);
+        impls[ov::element::Type_t::u8][ov::element::Type_t::u8][true] =
+            SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, uint8_t, jit_uni);
+        impls[ov::element::Type_t::u8][ov::element::Type_t::u8][false] =
+            SUPPORTED_IMPL(TwoPlaneConvert, uint8_t, uint8_t, jit_uni);
+        impls[ov::element::Type_t::u8][ov::element::Type_t::f32][true] =
+            SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, float, jit_uni);
+        impls[ov::element::Type_t::u8][ov::element::Type_t::f32][false] =
+            SUPPORTED_IMPL(TwoPlaneConvert, uint8_t, float, jit_uni);
+        impls[ov::element::Type_t::f32][ov::element::Type_t::f32][true] =
+            SUPPORTED_IMPL(SinglePlaneConvert, float, float, jit_uni);
+        impls[ov::element::Type_t::f32][ov::element::Type_t::f32][false] =
+            SUPPORTED_IMPL(TwoPlaneConvert, float, float, jit_uni);
     }
 #endif
 #undef SUPPORTED_IMPL
 }
 
 void ColorConvert::initSupportedI420Impls() {
-#define SUPPORTED_IMPL(Impl, type, desc_type)                         \
-    [](Node* node) {                                                  \
-        return new i420::Impl<type, impl_desc_type::desc_type>(node); \
+#define SUPPORTED_IMPL(Impl, type, out_type, desc_type)                         \
+    [](Node* node) {                                                            \
+        return new i420::Impl<type, out_type, impl_desc_type::desc_type>(node); \
     };
 
     // ref
     {
         auto& impls = _supportedImpls[impl_desc_type::ref][algorithm];
-        impls[ov::element::Type_t::u8][true] = SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, ref);
-        impls[ov::element::Type_t::u8][false] = SUPPORTED_IMPL(ThreePlaneConvert, uint8_t, ref);
-        impls[ov::element::Type_t::f32][true] = SUPPORTED_IMPL(SinglePlaneConvert, float, ref);
-        impls[ov::element::Type_t::f32][false] = SUPPORTED_IMPL(ThreePlaneConvert, float, ref);
+        impls[ov::element::Type_t::u8][ov::element::Type_t::u8][true] =
+            SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, uint8_t, ref);
+        impls[ov::element::Type_t::u8][ov::element::Type_t::u8][false] =
+            SUPPORTED_IMPL(ThreePlaneConvert, uint8_t, uint8_t, ref);
+        impls[ov::element::Type_t::u8][ov::element::Type_t::f32][true] =
+            SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, float, ref);
+        impls[ov::element::Type_t::u8][ov::element::Type_t::f32][false] =
+            SUPPORTED_IMPL(ThreePlaneConvert, uint8_t, float, ref);
+        impls[ov::element::Type_t::f32][ov::element::Type_t::f32][true] =
+            SUPPORTED_IMPL(SinglePlaneConvert, float, float, ref);
+        impls[ov::element::Type_t::f32][ov::element::Type_t::f32][false] =
+            SUPPORTED_IMPL(ThreePlaneConvert, float, float, ref);
     }
 
 #if defined(OPENVINO_ARCH_X86_64)
     // jit_uni
     {
         auto& impls = _supportedImpls[impl_desc_type::jit_uni][algorithm];
-        impls[ov::element::Type_t::u8][true] = SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, jit_uni);
-        impls[ov::element::Type_t::u8][false] = SUPPORTED_IMPL(ThreePlaneConvert, uint8_t, jit_uni);
-        impls[ov::element::Type_t::f32][true] = SUPPORTED_IMPL(SinglePlaneConvert, float, jit_uni);
-        impls[ov::element::Type_t::f32][false] = SUPPORTED_IMPL(ThreePlaneConvert, float, jit_uni);
+        impls[ov::element::Type_t::u8][ov::element::Type_t::u8][true] =
+            SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, uint8_t, jit_uni);
+        impls[ov::element::Type_t::u8][ov::element::Type_t::u8][false] =
+            SUPPORTED_IMPL(ThreePlaneConvert, uint8_t, uint8_t, jit_uni);
+        impls[ov::element::Type_t::u8][ov::element::Type_t::f32][true] =
+            SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, float, jit_uni);
+        impls[ov::element::Type_t::u8][ov::element::Type_t::f32][false] =
+            SUPPORTED_IMPL(ThreePlaneConvert, uint8_t, float, jit_uni);
+        impls[ov::element::Type_t::f32][ov::element::Type_t::f32][true] =
+            SUPPORTED_IMPL(SinglePlaneConvert, float, float, jit_uni);
+        impls[ov::element::Type_t::f32][ov::element::Type_t::f32][false] =
+            SUPPORTED_IMPL(ThreePlaneConvert, float, float, jit_uni);
     }
 #endif
 #undef SUPPORTED_IMPL
@@ -1108,10 +1146,14 @@ void ColorConvert::createPrimitive() {
     if (!_impl) {
         const auto& cfg = desc->getConfig();
         const auto precision = cfg.inConfs[0].getMemDesc()->getPrecision();
+        const auto outPrecision = cfg.outConfs[0].getMemDesc()->getPrecision();
         const bool isSinglePlane = cfg.inConfs.size() == 1;
 
-        _impl = std::unique_ptr<Converter>(
-            _supportedImpls.at(desc->getImplementationType()).at(algorithm).at(precision).at(isSinglePlane)(this));
+        _impl = std::unique_ptr<Converter>(_supportedImpls.at(desc->getImplementationType())
+                                               .at(algorithm)
+                                               .at(precision)
+                                               .at(outPrecision)
+                                               .at(isSinglePlane)(this));
     }
 }
 
@@ -47,7 +47,8 @@ private:
     using ConverterBuilder = std::function<Converter*(Node*)>;
     using SupportedImpls = multidim_map<impl_desc_type,       // Implementation type
                                         Algorithm,            // Algorithm: ColorConvertXXX
-                                        ov::element::Type_t,  // element type: f32/u8
+                                        ov::element::Type_t,  // input element type: f32/u8
+                                        ov::element::Type_t,  // output element type: f32/u8
                                         bool,  // true - SinglePlaneConvert, false - TwoPlaneConvert/ThreePlaneConvert
                                         ConverterBuilder>;
 
@@ -2455,6 +2455,29 @@ bool Eltwise::canFuseConvert(const NodePtr& convertNode) {
     return false;
 }
 
+// Select with a single element condition is an exit point of the static graph (see Graph::ResolveExitPoints)
+// if one of its branches is computed only for it, so the branch may be skipped once the condition is known
+static bool isExitPoint(const NodePtr& node) {
+    if (node->getAlgorithm() != Algorithm::EltwiseSelect || !node->getInputShapeAtPort(0).isStatic() ||
+        node->getInputShapeAtPort(0).getElementsCount() != 1) {
+        return false;
+    }
+    for (const int port : {1, 2}) {
+        const auto branch = node->getParentEdgeAt(port)->getParent();
+        if (branch->isConstant() || branch->getType() == Type::Input) {
+            continue;
+        }
+        const auto& childEdges = branch->getChildEdges();
+        if (std::all_of(childEdges.begin(), childEdges.end(), [&](const EdgeWeakPtr& weakEdge) {
+                const auto edge = weakEdge.lock();
+                return edge->getChild() == node && edge->getOutputNum() == port;
+            })) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool Eltwise::canFuse(const NodePtr& node) const {
     auto isIntegerComputeSupported = [](const Node* node) {
         if (none_of(node->getAlgorithm(),
@@ -2502,6 +2525,11 @@ bool Eltwise::canFuse(const NodePtr& node) const {
         return false;
     }
 
+    // the exit point is kept as a separate node, so the static graph can skip the branch that is not taken
+    if (context->getConfig().enableEarlyExit && isExitPoint(node)) {
+        return false;
+    }
+
     bool isIntegerNode = isIntegerComputeSupported(this);
     if (isIntegerNode && node->getType() != Type::Eltwise) {
         return false;
@@ -4,19 +4,29 @@
 
 #include "embedding_bag.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(OPENVINO_ARCH_X86_64)
+#    include <immintrin.h>
+#endif
 
 #include "cpu_memory.h"
 #include "cpu_types.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/parallel.hpp"
+#include "openvino/core/type/bfloat16.hpp"
 #include "openvino/core/type/element_type.hpp"
-#include "openvino/core/type/element_type_traits.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "utils/general_utils.h"
 
 namespace ov::intel_cpu::node {
 
@@ -50,9 +60,75 @@ void EmbeddingBag::prepareParams(const VectorDims& indexStaticShape) {
     }
 }
 
+void EmbeddingBag::fuseDecompression(std::vector<float> scales, std::vector<float> zeroPoints) {
+    _compressed = true;
+    _decompressionScales = std::move(scales);
+    _decompressionZeroPoints = std::move(zeroPoints);
+}
+
+namespace {
+
+// the rows of the huge tables are random accesses, so the next rows of the bag are requested in advance
+constexpr size_t PREFETCH_DISTANCE = 4LU;
+// the minimal part of the row processed by a thread when there are fewer bags than threads
+constexpr size_t MIN_DEPTH_BLOCK = 64LU;
+
 template <typename T>
+inline void prefetchRow([[maybe_unused]] const T* row, [[maybe_unused]] size_t count) {
+#if defined(OPENVINO_ARCH_X86_64)
+    const auto* ptr = reinterpret_cast<const char*>(row);
+    for (size_t i = 0; i < count * sizeof(T); i += 64) {
+        _mm_prefetch(ptr + i, _MM_HINT_T0);
+    }
+#endif
+}
+
+// dst = src * weight or dst += src * weight, the compressed rows are dequantized as (src - zp) * scale
+template <typename T, typename D>
+inline void accumulateRow(D* dst,
+                          const T* src,
+                          size_t count,
+                          bool first,
+                          bool withWeight,
+                          D weight,
+                          [[maybe_unused]] float scale,
+                          [[maybe_unused]] float zp) {
+    if constexpr (std::is_same_v<T, D>) {
+        if (withWeight && first) {
+            for (size_t i = 0LU; i < count; i++) {
+                dst[i] = src[i] * weight;
+            }
+        } else if (withWeight) {
+            for (size_t i = 0LU; i < count; i++) {
+                dst[i] += src[i] * weight;
+            }
+        } else if (first) {
+            std::copy_n(src, count, dst);
+        } else {
+            for (size_t i = 0LU; i < count; i++) {
+                dst[i] += src[i];
+            }
+        }
+    } else {
+        const float coef = withWeight ? scale * weight : scale;
+        const float shift = -zp * coef;
+        if (first) {
+            for (size_t i = 0LU; i < count; i++) {
+                dst[i] = static_cast<float>(src[i]) * coef + shift;
+            }
+        } else {
+            for (size_t i = 0LU; i < count; i++) {
+                dst[i] += static_cast<float>(src[i]) * coef + shift;
+            }
+        }
+    }
+}
+
+}  // namespace
+
+template <typename T, typename D>
 void EmbeddingBag::processData(const T* srcData,
-                               const T* weightsData,
+                               const D* weightsData,
                                const VectorDims& inDataDims,
                                const MemoryPtr& outMemory) {
     std::string msgPrefix = std::string("Node EmbeddingBag with name '") + _layerName + "' ";
@@ -60,12 +136,29 @@ void EmbeddingBag::processData(const T* srcData,
     initFromInputs();
 
     const size_t outputBagsNum = outMemory->getShape().getStaticDims()[0];
-    auto* dstData = outMemory->getDataAs<T>();
+    auto* dstData = outMemory->getDataAs<D>();
+
+    // a few big bags (e.g. the batch of 1 at the serving time) are split along the embedding depth as well
+    const auto maxThreads = static_cast<size_t>(parallel_get_max_threads());
+    size_t depthBlock = std::max(_embDepth, size_t{1});
+    if (outputBagsNum > 0 && outputBagsNum < maxThreads && _embDepth > MIN_DEPTH_BLOCK) {
+        depthBlock = std::max(rnd_up(div_up(_embDepth, div_up(maxThreads, outputBagsNum)), 16LU), MIN_DEPTH_BLOCK);
+    }
+    const size_t depthBlocks = std::max(div_up(_embDepth, depthBlock), size_t{1});
+
+    auto rowScale = [&](size_t row) {
+        return _decompressionScales.empty() ? 1.0F : _decompressionScales[_decompressionScales.size() == 1 ? 0 : row];
+    };
+    auto rowZeroPoint = [&](size_t row) {
+        return _decompressionZeroPoints.empty()
+                   ? 0.0F
+                   : _decompressionZeroPoints[_decompressionZeroPoints.size() == 1 ? 0 : row];
+    };
 
     auto threadBody = [&](const int ithr, const int nthr) {
         size_t start(0LU);
         size_t end(0LU);
-        splitter(outputBagsNum, nthr, ithr, start, end);
+        splitter(outputBagsNum * depthBlocks, nthr, ithr, start, end);
         if (start >= end) {
             return;
         }
@@ -75,53 +168,51 @@ void EmbeddingBag::processData(const T* srcData,
         int weightsIdx = 0LU;
         bool withWeights = _withWeights;
 
-        for (size_t obi = start; obi < end; obi++) {
-            size_t dstIndex = obi * _embDepth;
+        for (size_t work = start; work < end; work++) {
+            const size_t obi = work / depthBlocks;
+            const size_t depthStart = (work % depthBlocks) * depthBlock;
+            const size_t depthSize = std::min(depthBlock, _embDepth - depthStart);
+            D* dst = dstData + obi * _embDepth + depthStart;
             getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
 
-            if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
+            if (indices == nullptr) {
+                std::fill_n(dst, depthSize, static_cast<D>(0));
+                continue;
+            }
+            withWeights = withWeights & _withWeights;
+
+            auto prefetch = [&](size_t inIdx) {
+                const auto row = static_cast<size_t>(indices[inIdx]);
+                if (row < inDataDims[0]) {
+                    prefetchRow(srcData + row * _embDepth + depthStart, depthSize);
+                }
+            };
+            for (size_t inIdx = 0LU; inIdx < std::min(indicesSize, PREFETCH_DISTANCE); inIdx++) {
+                prefetch(inIdx);
+            }
 
-                size_t inIdx = 0LU;
+            for (size_t inIdx = 0LU; inIdx < indicesSize; inIdx++) {
                 OPENVINO_ASSERT(static_cast<size_t>(indices[inIdx]) < inDataDims[0],
                                 msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
-                size_t srcIndex = indices[inIdx] * _embDepth;
-
+                if (inIdx + PREFETCH_DISTANCE < indicesSize) {
+                    prefetch(inIdx + PREFETCH_DISTANCE);
+                }
+                const auto row = static_cast<size_t>(indices[inIdx]);
+                accumulateRow(dst,
+                              srcData + row * _embDepth + depthStart,
+                              depthSize,
+                              inIdx == 0LU,
+                              withWeights,
+                              withWeights ? weightsData[weightsIdx] : static_cast<D>(1),
+                              rowScale(row),
+                              rowZeroPoint(row));
                 if (withWeights) {
-                    for (size_t i = 0LU; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                    }
                     weightsIdx++;
-                } else {
-                    for (size_t i = 0LU; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
-                    }
-                }
-
-                for (inIdx = 1LU; inIdx < indicesSize; inIdx++) {
-                    OPENVINO_ASSERT(static_cast<size_t>(indices[inIdx]) < inDataDims[0],
-                                    msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0LU; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0LU; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
-                    }
-                }
-                if (_reduction == Reduction::MEAN) {
-                    for (size_t i = 0LU; i < _embDepth; i++) {
-                        dstData[dstIndex + i] /= indicesSize;
-                    }
                 }
-            } else {
-                for (size_t i = 0LU; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
+            }
+            if (_reduction == Reduction::MEAN) {
+                for (size_t i = 0LU; i < depthSize; i++) {
+                    dst[i] /= indicesSize;
                 }
             }
         }
@@ -135,30 +226,52 @@ void EmbeddingBag::execute(const uint8_t* srcData,
                            const ov::element::Type& srcPrc,
                            const VectorDims& inDims,
                            const MemoryPtr& outMemory) {
+    if (_compressed) {
+        const auto* weights = reinterpret_cast<const float*>(weightsData);
+        switch (srcPrc) {
+        case ov::element::u8:
+            processData(srcData, weights, inDims, outMemory);
+            break;
+        case ov::element::i8:
+            processData(reinterpret_cast<const int8_t*>(srcData), weights, inDims, outMemory);
+            break;
+        case ov::element::f16:
+            processData(reinterpret_cast<const ov::float16*>(srcData), weights, inDims, outMemory);
+            break;
+        case ov::element::bf16:
+            processData(reinterpret_cast<const ov::bfloat16*>(srcData), weights, inDims, outMemory);
+            break;
+        default:
+            OPENVINO_THROW("EmbeddingBag layer does not support compressed precision '" +
+                           std::string(srcPrc.get_type_name()) + "'");
+        }
+        return;
+    }
+
     switch (srcPrc) {
     case ov::element::f32: {
-        processData<element_type_traits<ov::element::f32>::value_type>(reinterpret_cast<const float*>(srcData),
-                                                                       reinterpret_cast<const float*>(weightsData),
-                                                                       inDims,
-                                                                       outMemory);
+        processData(reinterpret_cast<const float*>(srcData),
+                    reinterpret_cast<const float*>(weightsData),
+                    inDims,
+                    outMemory);
         break;
     }
     case ov::element::i8: {
-        processData<element_type_traits<ov::element::i8>::value_type>(reinterpret_cast<const int8_t*>(srcData),
-                                                                      reinterpret_cast<const int8_t*>(weightsData),
-                                                                      inDims,
-                                                                      outMemory);
+        processData(reinterpret_cast<const int8_t*>(srcData),
+                    reinterpret_cast<const int8_t*>(weightsData),
+                    inDims,
+                    outMemory);
         break;
     }
     case ov::element::u8: {
-        processData<element_type_traits<ov::element::u8>::value_type>(srcData, weightsData, inDims, outMemory);
+        processData(srcData, weightsData, inDims, outMemory);
         break;
     }
     case ov::element::i32: {
-        processData<element_type_traits<ov::element::i32>::value_type>(reinterpret_cast<const int32_t*>(srcData),
-                                                                       reinterpret_cast<const int32_t*>(weightsData),
-                                                                       inDims,
-                                                                       outMemory);
+        processData(reinterpret_cast<const int32_t*>(srcData),
+                    reinterpret_cast<const int32_t*>(weightsData),
+                    inDims,
+                    outMemory);
         break;
     }
     default: {
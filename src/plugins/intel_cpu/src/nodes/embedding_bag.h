@@ -8,6 +8,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "cpu_memory.h"
 #include "cpu_types.h"
@@ -33,6 +34,15 @@ public:
 
     virtual ~EmbeddingBag() = default;
 
+    /**
+     * @brief Keeps the embedding table compressed (u8/i8 rows with the per row scale and zero point or f16/bf16 rows),
+     * the rows are converted to f32 while they are accumulated. Empty scales / zero points stand for 1 / 0.
+     */
+    void fuseDecompression(std::vector<float> scales, std::vector<float> zeroPoints);
+    bool isCompressed() const {
+        return _compressed;
+    }
+
 protected:
     virtual void initFromInputs() = 0;
     virtual void getIndices(size_t embIndex,
@@ -43,8 +53,8 @@ protected:
 
     void prepareParams(const VectorDims& indexStaticShape);
 
-    template <typename T>
-    void processData(const T* srcData, const T* weightsData, const VectorDims& inDataDims, const MemoryPtr& outMemory);
+    template <typename T, typename D>
+    void processData(const T* srcData, const D* weightsData, const VectorDims& inDataDims, const MemoryPtr& outMemory);
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -55,6 +65,10 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    bool _compressed = false;
+    std::vector<float> _decompressionScales;
+    std::vector<float> _decompressionZeroPoints;
 };
 
 }  // namespace ov::intel_cpu::node
@@ -101,13 +101,17 @@ void EmbeddingBagPacked::initSupportedPrimitiveDescriptors() {
                         inDataPrecision.get_type_name());
     }
 
+    // the compressed table keeps its own precision and is dequantized to f32 by the node
+    const auto tablePrecision = isCompressed() ? getOriginalInputPrecisionAtPort(EMB_TABLE_IDX) : inDataPrecision;
+    const auto outPrecision = isCompressed() ? ov::element::f32 : inDataPrecision;
+
     std::vector<PortConfigurator> inDataConfigurators(
-        {{LayoutType::ncsp, inDataPrecision}, {LayoutType::ncsp, ov::element::i32}});
+        {{LayoutType::ncsp, tablePrecision}, {LayoutType::ncsp, ov::element::i32}});
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX) {
-        inDataConfigurators.emplace_back(LayoutType::ncsp, inDataPrecision);
+        inDataConfigurators.emplace_back(LayoutType::ncsp, outPrecision);
     }
 
-    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, outPrecision}}, impl_desc_type::ref_any);
 }
 
 void EmbeddingBagPacked::prepareParams() {
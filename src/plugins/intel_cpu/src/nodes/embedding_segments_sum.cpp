@@ -4,6 +4,7 @@
 
 #include "embedding_segments_sum.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
@@ -88,7 +89,11 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
                         inDataPrecision.get_type_name());
     }
 
-    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, inDataPrecision},
+    // the compressed table keeps its own precision and is dequantized to f32 by the node
+    const auto tablePrecision = isCompressed() ? getOriginalInputPrecisionAtPort(EMB_TABLE_IDX) : inDataPrecision;
+    const auto outPrecision = isCompressed() ? ov::element::f32 : inDataPrecision;
+
+    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, tablePrecision},
                                                        {LayoutType::ncsp, ov::element::i32},
                                                        {LayoutType::ncsp, ov::element::i32},
                                                        {LayoutType::ncsp, ov::element::i32}});
@@ -96,10 +101,10 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
         inDataConfigurators.emplace_back(LayoutType::ncsp, ov::element::i32);
     }
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX) {
-        inDataConfigurators.emplace_back(LayoutType::ncsp, inDataPrecision);
+        inDataConfigurators.emplace_back(LayoutType::ncsp, outPrecision);
     }
 
-    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, outPrecision}}, impl_desc_type::ref_any);
 }
 
 void EmbeddingSegmentsSum::prepareParams() {
@@ -129,14 +134,13 @@ void EmbeddingSegmentsSum::getIndices(size_t embIndex,
     size = 0;
     withWeight = true;
 
-    for (int si = 0; si < static_cast<int>(indicesSize_); si++) {
-        if (static_cast<size_t>(segmentIds_[si]) == embIndex) {
-            size++;
-            if (indices == nullptr) {
-                indices = indices_ + si;
-                weightsIdx = si;
-            }
-        }
+    // segment ids are sorted, so the indices of the segment are found without scanning all of them per segment
+    const auto* segmentIdsEnd = segmentIds_ + indicesSize_;
+    const auto segment = std::equal_range(segmentIds_, segmentIdsEnd, static_cast<int>(embIndex));
+    size = static_cast<size_t>(segment.second - segment.first);
+    if (size != 0) {
+        indices = indices_ + (segment.first - segmentIds_);
+        weightsIdx = static_cast<int>(segment.first - segmentIds_);
     }
 
     // Empty bag
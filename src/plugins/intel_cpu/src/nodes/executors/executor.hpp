@@ -18,6 +18,7 @@
 #include "dnnl_scratch_pad.h"
 #include "graph_context.h"
 #include "memory_arguments.hpp"
+#include "nodes/executors/executor_tuning_db.hpp"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/visibility.hpp"
@@ -49,7 +50,8 @@ public:
           engine(graphContext->getEngine()),
           implPriorities(std::move(implPriorities)),
           privateWeighCache(std::move(privateWeighCache)),
-          numNumaNodes(graphContext->getNumNumaNodes()) {
+          numNumaNodes(graphContext->getNumNumaNodes()),
+          tuningDb(ExecutorTuningDb::get(graphContext->getConfig().executorTuningDb)) {
         auto cpuStreamsExecutor = graphContext->getCPUStreamExecutor();
         curNumaNodeId = std::max(0, cpuStreamsExecutor ? cpuStreamsExecutor->get_numa_node_id() : curNumaNodeId);
     }
@@ -80,6 +82,11 @@ public:
         return weightsCache;
     }
 
+    // nullptr if the implementations tuning is disabled
+    [[nodiscard]] ExecutorTuningDb::Ptr getTuningDb() const {
+        return tuningDb;
+    }
+
 private:
     // weak_ptr is required to avoid cycle dependencies with MultiCache
     // since ExecutorContext is stored in Executor itself
@@ -91,6 +98,7 @@ private:
     // @todo remove after global cache is used exclusevly
     std::shared_ptr<std::unordered_map<std::string, MemoryPtr>> privateWeighCache;
     int numNumaNodes;
+    ExecutorTuningDb::Ptr tuningDb;
     int curNumaNodeId = -1;
 };
 
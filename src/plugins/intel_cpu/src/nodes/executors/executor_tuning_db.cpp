@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "executor_tuning_db.hpp"
+
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "openvino/util/log.hpp"
+#include "utils/debug_capabilities.h"
+
+namespace ov::intel_cpu {
+
+ExecutorTuningDb::ExecutorTuningDb(std::string path) : m_path(std::move(path)) {
+    load();
+}
+
+ExecutorTuningDb::Ptr ExecutorTuningDb::get(const std::string& path) {
+    if (path.empty()) {
+        return nullptr;
+    }
+
+    static std::mutex registryMutex;
+    static std::unordered_map<std::string, std::weak_ptr<ExecutorTuningDb>> registry;
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    auto& entry = registry[path];
+    auto db = entry.lock();
+    if (!db) {
+        db = std::make_shared<ExecutorTuningDb>(path);
+        entry = db;
+    }
+    return db;
+}
+
+std::optional<std::string> ExecutorTuningDb::find(const std::string& key) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto found = m_entries.find(key);
+    if (found == m_entries.end()) {
+        return std::nullopt;
+    }
+    return found->second;
+}
+
+void ExecutorTuningDb::store(const std::string& key, const std::string& implementation) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries[key] = implementation;
+
+    std::ofstream file(m_path, std::ios::app);
+    if (!file.is_open()) {
+        // the entry is still used by this process, the tuning is just not persisted
+        OPENVINO_WARN("Cannot open the executor tuning database ", m_path, ", the tuning results are not saved");
+        return;
+    }
+    // a single write per entry keeps the concurrent appends of several processes line aligned
+    file << (key + '\t' + implementation + '\n') << std::flush;
+}
+
+void ExecutorTuningDb::load() {
+    std::ifstream file(m_path);
+    std::string line;
+    while (std::getline(file, line)) {
+        const auto separator = line.rfind('\t');
+        if (separator == std::string::npos || separator == 0 || separator + 1 == line.size()) {
+            DEBUG_LOG("Skipping malformed executor tuning entry: ", line);
+            continue;
+        }
+        m_entries[line.substr(0, separator)] = line.substr(separator + 1);
+    }
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,46 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Persistent storage of the executor implementations which were the fastest ones for the given
+ * tuning keys (operation, shapes bucket, precisions and ISA).
+ *
+ * The entries are appended to the file as "<key>\t<implementation>" lines, so the database can be shared
+ * by several processes. The file is read once, when the database is created. The last entry for a key wins.
+ * If the file cannot be written, the entries are kept in memory only.
+ */
+class ExecutorTuningDb {
+public:
+    using Ptr = std::shared_ptr<ExecutorTuningDb>;
+
+    explicit ExecutorTuningDb(std::string path);
+
+    /**
+     * @brief Returns the database associated with the file \p path, so the compiled models which use the same
+     * file share the entries. Returns nullptr if \p path is empty.
+     */
+    static Ptr get(const std::string& path);
+
+    std::optional<std::string> find(const std::string& key);
+    void store(const std::string& key, const std::string& implementation);
+
+private:
+    void load();
+
+    const std::string m_path;
+    std::mutex m_mutex;
+    std::unordered_map<std::string, std::string> m_entries;
+};
+
+}  // namespace ov::intel_cpu
@@ -40,6 +40,7 @@
 #    include "memory_desc/cpu_memory_desc_utils.h"
 #    include "memory_desc/dnnl_memory_desc.h"
 #    include "nodes/executors/dnnl/dnnl_convolution_primitive.hpp"
+#    include "nodes/executors/x64/dyn_quant_fc.hpp"
 #    include "onednn/iml_type_mapper.h"
 #endif
 
@@ -444,6 +445,38 @@ const std::vector<ExecutorImplementation<FCAttrs>>& getImplementations() {
                     context,
                     false);
             })
+        OV_CPU_INSTANCE_X64(
+            "fullyconnected_dyn_quant_avx2",
+            ExecutorType::jit_x64,
+            OperationType::FullyConnected,
+            ShapeTolerance::Dependant,
+            // supports
+            [](const FCConfig& config) -> bool {
+                VERIFY(noPostOps(config), UNSUPPORTED_POST_OPS);
+                VERIFY(noSparseDecompression(config), UNSUPPORTED_SPARSE_WEIGHTS);
+                // the hosts with VNNI use the dynamic quantization of oneDNN
+                VERIFY(dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2) &&
+                       !dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2_vnni) &&
+                       !dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_vnni), UNSUPPORTED_ISA);
+                VERIFY(srcType(config) == f32, UNSUPPORTED_SRC_PRECISIONS);
+                VERIFY(any_of(weiType(config), u4, i4), UNSUPPORTED_WEI_PRECISIONS);
+                VERIFY(dstType(config) == f32, UNSUPPORTED_DST_PRECISIONS);
+
+                return DynQuantFCExecutor::supports(config);
+            },
+            // createOptimalConfig
+            [](const FCConfig& config) -> std::optional<executor::Config<FCAttrs>> {
+                return createOptimalConfigCommon(config,
+                                                 dnnlFCTypeMapping,
+                                                 dnnlFCLayoutConfig,
+                                                 dnnlConvolutionMappingNotation);
+            },
+            // acceptsShapes
+            [](const FCAttrs& attrs, const MemoryArgs& memory) -> bool {
+                return DynQuantFCExecutor::acceptsShapes(attrs, memory);
+            },
+            CreateDefault<DynQuantFCExecutor, FCAttrs>{}
+            )
         OV_CPU_INSTANCE_DNNL(
             "fullyconnected_dnnl",
             ExecutorType::Dnnl,
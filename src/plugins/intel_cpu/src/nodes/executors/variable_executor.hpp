@@ -4,18 +4,28 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cstddef>
 #include <functional>
+#include <map>
+#include <memory>
+#include <oneapi/dnnl/dnnl.hpp>
+#include <sstream>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "cpu_memory.h"
 #include "executor.hpp"
 #include "executor_implementation.hpp"
+#include "nodes/executors/executor_tuning_db.hpp"
 #include "nodes/executors/graph_emitter.hpp"
 #include "nodes/executors/memory_arguments.hpp"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
+#include "utils/debug_capabilities.h"
 
 namespace ov::intel_cpu {
 
@@ -23,6 +33,8 @@ namespace ov::intel_cpu {
  * A stateful (variable) executor
  * Contains two or more executors.
  * Switches between the executors based on provided Memory (more precisely based on in / out shapes)
+ * If the tuning database is provided by the context, the executors which accept the shapes are benchmarked
+ * and the fastest one is used instead of the first one in the priority order
  */
 template <typename Attrs>
 class VariableExecutor : public Executor {
@@ -43,6 +55,10 @@ public:
     }
 
     bool update(const MemoryArgs& memory) override {
+        if (const auto& tuningDb = m_context->getTuningDb(); tuningDb && tune(*tuningDb, memory)) {
+            return true;
+        }
+
         for (auto implId = select(memory, 0); implId < m_suitableImplementations.size();
              implId = select(memory, ++implId)) {
             if (!m_executors[implId]) {
@@ -92,6 +108,110 @@ private:
         return std::distance(m_suitableImplementations.begin(), selectedImplementation);
     }
 
+    bool tune(ExecutorTuningDb& tuningDb, const MemoryArgs& memory) {
+        std::vector<size_t> candidates;
+        for (size_t implId = 0; implId < m_suitableImplementations.size(); implId++) {
+            const auto& implementation = m_suitableImplementations[implId].get();
+            if (implementation.shapeAgnostic() || implementation.acceptsShapes(m_attrs, memory)) {
+                candidates.push_back(implId);
+            }
+        }
+        if (candidates.size() < 2) {
+            return false;
+        }
+
+        const auto key = tuningKey(memory, candidates);
+        if (const auto winner = tuningDb.find(key)) {
+            for (const auto implId : candidates) {
+                if (m_suitableImplementations[implId].get().name() == *winner && prepare(implId, memory)) {
+                    m_implId = implId;
+                    return true;
+                }
+            }
+        }
+
+        // the output is redirected, so the executors which accumulate into the destination don't corrupt it
+        auto benchmarkMemory = memory;
+        if (const auto dst = memory.find(ARG_DST); dst != memory.end() && dst->second) {
+            benchmarkMemory[ARG_DST] = std::make_shared<Memory>(m_context->getEngine(), dst->second->getDescPtr());
+        }
+
+        size_t bestImplId = m_suitableImplementations.size();
+        auto bestTime = std::chrono::steady_clock::duration::max();
+        for (const auto implId : candidates) {
+            if (!prepare(implId, memory)) {
+                continue;
+            }
+            const auto time = measure(*m_executors[implId], benchmarkMemory);
+            DEBUG_LOG("Tuning ",
+                      m_suitableImplementations[implId].get().name(),
+                      ": ",
+                      std::chrono::duration_cast<std::chrono::microseconds>(time).count(),
+                      " us");
+            if (time < bestTime) {
+                bestTime = time;
+                bestImplId = implId;
+            }
+        }
+        if (bestImplId == m_suitableImplementations.size()) {
+            return false;
+        }
+
+        // only the winner is used for these shapes, so the other executors are not kept alive
+        for (const auto implId : candidates) {
+            if (implId != bestImplId) {
+                m_executors[implId].reset();
+            }
+        }
+
+        tuningDb.store(key, m_suitableImplementations[bestImplId].get().name());
+        m_implId = bestImplId;
+        return true;
+    }
+
+    bool prepare(const size_t implId, const MemoryArgs& memory) {
+        if (!m_executors[implId]) {
+            m_executors[implId] = create(implId, memory);
+        }
+        return m_executors[implId]->update(memory);
+    }
+
+    static std::chrono::steady_clock::duration measure(Executor& executor, const MemoryArgs& memory) {
+        constexpr int iterations = 5;
+        executor.execute(memory);  // warm up
+        auto best = std::chrono::steady_clock::duration::max();
+        for (int i = 0; i < iterations; i++) {
+            const auto start = std::chrono::steady_clock::now();
+            executor.execute(memory);
+            best = std::min(best, std::chrono::steady_clock::now() - start);
+        }
+        return best;
+    }
+
+    // the candidates, the shapes rounded up to the powers of two, the precisions and the ISA
+    [[nodiscard]] std::string tuningKey(const MemoryArgs& memory, const std::vector<size_t>& candidates) const {
+        std::ostringstream key;
+        for (const auto implId : candidates) {
+            key << m_suitableImplementations[implId].get().name() << ',';
+        }
+        const std::map<int, MemoryPtr> sorted(memory.begin(), memory.end());
+        for (const auto& [argId, mem] : sorted) {
+            if (!mem || !mem->getShape().isStatic()) {
+                continue;
+            }
+            key << '|' << argId << ':' << mem->getPrecision() << ':';
+            for (const auto dim : mem->getStaticDims()) {
+                size_t bucket = 1;
+                while (bucket < dim) {
+                    bucket <<= 1;
+                }
+                key << (dim == 0 ? 0 : bucket) << 'x';
+            }
+        }
+        key << "|isa:" << static_cast<int>(dnnl::get_effective_cpu_isa());
+        return key.str();
+    }
+
     ExecutorPtr create(const size_t implId, const MemoryArgs& memory) {
         assert(implId < m_executors.size() && implId < m_suitableImplementations.size());
 
@@ -0,0 +1,296 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dyn_quant_fc.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/common/cpu_convert.h"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "nodes/kernels/x64/dyn_quant_gemm.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu {
+
+using namespace ov::element;
+
+// the kernel computes the output channels by the blocks of 8
+static constexpr size_t nBlk = 8;
+// the rows of the activations processed by a single task
+static constexpr size_t mChunk = 64;
+
+static Dim batchDim(const VectorDims& dims) {
+    return std::accumulate(dims.begin(), dims.end() - 1, 1, std::multiplies<>());
+}
+
+static MemoryCPtr findMemory(const MemoryArgs& memory, int argId) {
+    const auto it = memory.find(argId);
+    return it == memory.end() ? nullptr : it->second;
+}
+
+static size_t elementsCount(const MemoryCPtr& mem) {
+    return mem ? mem->getShape().getElementsCount() : 0;
+}
+
+// the number of the weights quantization groups along K, 0 if the decompression parameters are not supported
+static size_t weightsGroups(const MemoryArgs& memory, const size_t N) {
+    const auto scales = findMemory(memory, ARG_WEI | ARG_ATTR_SCALES);
+    if (!scales) {
+        return 0;
+    }
+    const size_t scalesCount = elementsCount(scales);
+    const size_t groups = scalesCount > N ? scalesCount / N : 1;
+    if (scalesCount != 1 && scalesCount != N * groups) {
+        return 0;
+    }
+    // the zero points may be broadcasted, but must not be more granular than the scales
+    if (const auto zp = findMemory(memory, ARG_WEI | ARG_ATTR_ZERO_POINTS)) {
+        const size_t zpCount = elementsCount(zp);
+        if (zpCount != 1 && zpCount != N && zpCount != N * groups) {
+            return 0;
+        }
+    }
+    return groups;
+}
+
+static size_t blockSize(const size_t group, const size_t dqGroupSize) {
+    return std::min<size_t>(group, dqGroupSize);
+}
+
+static uint8_t getU4(const uint8_t* data, const size_t idx) {
+    const uint8_t byte = data[idx / 2];
+    return static_cast<uint8_t>(idx % 2 ? byte >> 4 : byte & 0x0F);
+}
+
+// packs the weights in the layout of dq_fc_gemm: [N / 8][K / 8][32 bytes] followed by
+// the scales and the zero points [N / 8][K / group][8] and the compensations [N / 8][K / block][8]
+static MemoryCPtr prepareWeightMemory(const MemoryArgs& memory,
+                                      const ExecutorContext::CPtr& context,
+                                      const size_t N,
+                                      const size_t K,
+                                      const size_t group,
+                                      const size_t block) {
+    const auto weightsMemory = memory.at(ARG_WEI);
+    const auto scalesMemory = memory.at(ARG_WEI | ARG_ATTR_SCALES);
+    const auto zpMemory = findMemory(memory, ARG_WEI | ARG_ATTR_ZERO_POINTS);
+
+    const size_t NB = div_up(N, nBlk);
+    const size_t groups = K / group;
+    const size_t blocks = K / block;
+    const size_t weightsSize = NB * K * 4;
+    const size_t paramsCount = NB * groups * nBlk;
+    const size_t compCount = NB * blocks * nBlk;
+    const size_t packedSize =
+        weightsSize + paramsCount * (sizeof(float) + sizeof(int32_t)) + compCount * sizeof(int32_t);
+
+    auto create = [&]() {
+        DEBUG_LOG("DynQuantFCExecutor: cache miss, perform packing");
+        MemoryPtr _ptr = std::make_shared<Memory>(context->getEngine(),
+                                                  intel_cpu::CpuBlockedMemoryDesc(u8, intel_cpu::Shape{packedSize}));
+        auto* dst = _ptr->getDataAs<uint8_t>();
+        std::memset(dst, 0, packedSize);
+        auto* packedScales = reinterpret_cast<float*>(dst + weightsSize);
+        auto* packedZp = reinterpret_cast<int32_t*>(packedScales + paramsCount);
+        auto* packedComp = packedZp + paramsCount;
+
+        const auto weiPrecision = weightsMemory->getPrecision();
+        const auto* weights = weightsMemory->getDataAs<const uint8_t>();
+
+        const size_t scalesCount = elementsCount(scalesMemory);
+        std::vector<float> scales(scalesCount);
+        cpu_convert(scalesMemory->getData(), scales.data(), scalesMemory->getPrecision(), f32, scalesCount);
+
+        // i4 weights are stored shifted by 8, so they are decompressed with the implicit zero point 8
+        const size_t zpCount = elementsCount(zpMemory);
+        std::vector<int32_t> zp(std::max<size_t>(zpCount, 1), weiPrecision == i4 ? 8 : 0);
+        if (zpMemory) {
+            const auto* zpData = zpMemory->getDataAs<const uint8_t>();
+            for (size_t i = 0; i < zpCount; i++) {
+                zp[i] = zpMemory->getPrecision() == u4 ? getU4(zpData, i) : zpData[i];
+            }
+        }
+        auto paramIdx = [N, groups](const size_t count, const size_t n, const size_t g) {
+            return count == 1 ? 0 : count == N ? n : n * groups + g;
+        };
+
+        ov::parallel_for(NB, [&](size_t nb) {
+            uint8_t* w = dst + nb * K * 4;
+            for (size_t n = nb * nBlk; n < std::min(N, (nb + 1) * nBlk); n++) {
+                const size_t lane = n % nBlk;
+                for (size_t k = 0; k < K; k++) {
+                    uint8_t v = getU4(weights, n * K + k);
+                    if (weiPrecision == i4) {
+                        v ^= 0x08;
+                    }
+                    w[(k / 8) * 32 + lane * 4 + k % 4] |= static_cast<uint8_t>((k % 8) < 4 ? v : v << 4);
+                    packedComp[(nb * blocks + k / block) * nBlk + lane] += 128 * v;
+                }
+                for (size_t g = 0; g < groups; g++) {
+                    packedScales[(nb * groups + g) * nBlk + lane] = scales[paramIdx(scalesCount, n, g)];
+                    packedZp[(nb * groups + g) * nBlk + lane] = zp[paramIdx(std::max<size_t>(zpCount, 1), n, g)];
+                }
+            }
+        });
+        return _ptr;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        const std::string string_hash =
+            "dq_fc_avx2_" + std::to_string(N) + "_" + std::to_string(K) + "_" + std::to_string(group) + "_" +
+            std::to_string(block) + "_" + std::to_string(reinterpret_cast<uint64_t>(weightsMemory->getData())) + "_" +
+            std::to_string(reinterpret_cast<uint64_t>(scalesMemory->getData())) + "_" +
+            std::to_string(zpMemory ? reinterpret_cast<uint64_t>(zpMemory->getData()) : 0);
+        DEBUG_LOG("DynQuantFCExecutor: findOrCreate, string_hash: ", string_hash);
+        return *weightCache->findOrCreate(string_hash, create);
+    }
+
+    DEBUG_LOG("DynQuantFCExecutor: Weights cache is not available");
+    return create();
+}
+
+bool DynQuantFCExecutor::supports(const FCConfig& config) {
+    const auto& attrs = config.attrs;
+    if (attrs.dynamicQuantizationGroupSize == 0 || attrs.weightsNonTransposed || attrs.nonConstantWeights) {
+        DEBUG_LOG("DynQuantFCExecutor: dynamic quantization is disabled or the weights are not constant");
+        return false;
+    }
+
+    const auto& weiDesc = config.descs.at(ARG_WEI);
+    if (weiDesc->getShape().getRank() != 2 || !weiDesc->getShape().isStatic()) {
+        DEBUG_LOG("DynQuantFCExecutor: only static 2D weights are supported");
+        return false;
+    }
+
+    // the quantized activations are processed by the chunks of 8 values of K
+    if (weiDesc->getShape().getStaticDims()[1] % 8) {
+        DEBUG_LOG("DynQuantFCExecutor: IC must be a multiple of 8");
+        return false;
+    }
+
+    return true;
+}
+
+bool DynQuantFCExecutor::acceptsShapes(const FCAttrs& attrs, const MemoryArgs& memory) {
+    const auto& wgtDims = memory.at(ARG_WEI)->getStaticDims();
+    const size_t N = batchDim(wgtDims);
+    const size_t K = wgtDims.back();
+
+    // i8 / i4 weights with zero points can't be shifted to unsigned ones
+    if (memory.at(ARG_WEI)->getPrecision() == i4 && findMemory(memory, ARG_WEI | ARG_ATTR_ZERO_POINTS)) {
+        return false;
+    }
+    if (const auto zp = findMemory(memory, ARG_WEI | ARG_ATTR_ZERO_POINTS);
+        zp && none_of(zp->getPrecision(), u8, u4)) {
+        return false;
+    }
+
+    const size_t groups = weightsGroups(memory, N);
+    if (groups == 0 || K % groups) {
+        return false;
+    }
+    const size_t group = K / groups;
+    const size_t block = blockSize(group, attrs.dynamicQuantizationGroupSize);
+    return block % 8 == 0 && group % block == 0;
+}
+
+DynQuantFCExecutor::DynQuantFCExecutor(const FCAttrs& attrs,
+                                       const MemoryArgs& memory,
+                                       const ExecutorContext::CPtr& context)
+    : m_withBias(attrs.withBias),
+      N(batchDim(memory.at(ARG_WEI)->getStaticDims())),
+      K(memory.at(ARG_WEI)->getStaticDims().back()),
+      m_group(K / weightsGroups(memory, N)),
+      m_block(blockSize(m_group, attrs.dynamicQuantizationGroupSize)),
+      packedWeights(prepareWeightMemory(memory, context, N, K, m_group, m_block)) {}
+
+bool DynQuantFCExecutor::update(const MemoryArgs& memory) {
+    const auto& outDims = memory.at(ARG_DST)->getDescPtr()->getShape().getStaticDims();
+    M = batchDim(outDims);
+
+    const size_t blocks = K / m_block;
+    m_src.resize(M * K);
+    m_srcScales.resize(M * blocks);
+    m_srcSums.resize(M * blocks);
+
+    return true;
+}
+
+void DynQuantFCExecutor::execute(const MemoryArgs& memory) {
+    const auto* src = memory.at(ARG_SRC)->getDataAs<const float>();
+    auto* dst = memory.at(ARG_DST)->getDataAs<float>();
+    const auto* bias = m_withBias ? memory.at(ARG_BIAS)->getDataAs<const float>() : nullptr;
+
+    const size_t NB = div_up(N, nBlk);
+    const size_t groups = K / m_group;
+    const size_t blocks = K / m_block;
+    const auto* weights = packedWeights->getDataAs<const uint8_t>();
+    const auto* wScales = reinterpret_cast<const float*>(weights + NB * K * 4);
+    const auto* wZp = reinterpret_cast<const int32_t*>(wScales + NB * groups * nBlk);
+    const auto* wComp = wZp + NB * groups * nBlk;
+
+    ov::parallel_for(M, [&](size_t m) {
+        ov::Extensions::Cpu::XARCH::dq_fc_quantize_src(src + m * K,
+                                                       K,
+                                                       m_src.data() + m * K,
+                                                       K,
+                                                       1,
+                                                       K,
+                                                       m_block,
+                                                       m_srcScales.data() + m * blocks,
+                                                       m_srcSums.data() + m * blocks);
+    });
+
+    // the output channels are split into enough chunks to load all the threads with a few rows as well
+    const size_t mChunks = div_up(M, mChunk);
+    const size_t nChunks = std::min(NB, div_up(static_cast<size_t>(parallel_get_max_threads()) * 2, mChunks));
+    ov::parallel_for2d(mChunks, nChunks, [&](size_t mc, size_t nc) {
+        size_t nbStart = 0;
+        size_t nbEnd = 0;
+        ov::splitter(NB, nChunks, nc, nbStart, nbEnd);
+        const size_t m0 = mc * mChunk;
+        ov::Extensions::Cpu::XARCH::dq_fc_gemm(m_src.data() + m0 * K,
+                                               K,
+                                               m_srcScales.data() + m0 * blocks,
+                                               m_srcSums.data() + m0 * blocks,
+                                               std::min(mChunk, M - m0),
+                                               weights,
+                                               wScales,
+                                               wZp,
+                                               wComp,
+                                               K,
+                                               m_block,
+                                               m_group,
+                                               nbStart * nBlk,
+                                               std::min(nbEnd * nBlk, N),
+                                               bias,
+                                               dst + m0 * N,
+                                               N);
+    });
+}
+
+void DynQuantFCExecutor::moveMemToNumaNode(int numaNodeID) {
+    if (curNumaNode == numaNodeID) {
+        return;
+    }
+    curNumaNode = numaNodeID;
+    mbind_move(packedWeights, numaNodeID);
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "onednn/iml_type_mapper.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * FullyConnected with u4 / i4 grouped weights for the AVX2 hosts without VNNI.
+ * The activations are quantized to int8 dynamically by the blocks of the dynamic quantization group size,
+ * so the dot products are computed by the integer instructions instead of decompressing the weights to f32.
+ */
+class DynQuantFCExecutor : public Executor {
+public:
+    DynQuantFCExecutor(const FCAttrs& attrs, const MemoryArgs& memory, const ExecutorContext::CPtr& context);
+
+    void execute(const MemoryArgs& memory) override;
+
+    [[nodiscard]] impl_desc_type implType() const override {
+        return impl_desc_type::gemm_avx2;
+    }
+
+    // offloads execution data preparation from the exec call
+    bool update(const MemoryArgs& memory) override;
+
+    static bool supports(const FCConfig& config);
+
+    // checks the weights group size against the dynamic quantization group size
+    static bool acceptsShapes(const FCAttrs& attrs, const MemoryArgs& memory);
+
+    void moveMemToNumaNode(int numaNodeID) override;
+
+private:
+    const bool m_withBias;
+    const size_t N, K, m_group, m_block;
+    const MemoryCPtr packedWeights;
+    size_t M = 0;
+    // quantized activations and the scales / sums of their blocks
+    std::vector<uint8_t> m_src;
+    std::vector<float> m_srcScales;
+    std::vector<int32_t> m_srcSums;
+    int curNumaNode = -1;
+};
+
+}  // namespace ov::intel_cpu
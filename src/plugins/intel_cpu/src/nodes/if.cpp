@@ -4,12 +4,14 @@
 
 #include "if.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <deque>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -21,12 +23,14 @@
 #include "node.h"
 #include "nodes/common/blocked_desc_creator.h"
 #include "nodes/common/cpu_convert.h"
+#include "nodes/input.h"
 #include "nodes/node_config.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/op/if.hpp"
+#include "openvino/op/parameter.hpp"
 #include "shape_inference/shape_inference_internal_dyn.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
@@ -101,9 +105,6 @@ void If::initSupportedPrimitiveDescriptors() {
         return;
     }
 
-    m_thenGraph.Init(m_op->get_then_body(), context);
-    m_elseGraph.Init(m_op->get_else_body(), context);
-
     NodeConfig config;
     config.inConfs.reserve(getParentEdges().size());
     config.outConfs.reserve(getChildEdges().size());
@@ -126,7 +127,164 @@ void If::initSupportedPrimitiveDescriptors() {
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
 }
 
+void If::selectOptimalPrimitiveDescriptor() {
+    Node::selectOptimalPrimitiveDescriptor();
+
+    // the bodies are initialized when the parent nodes configuration is already selected,
+    // since it defines whether the memory of the node inputs can be shared with the bodies
+    initBody(true);
+    initBody(false);
+}
+
+bool If::canShareInputMemory(const size_t port) const {
+    // the body may modify its input in place, so the memory is shared only if the node is the only consumer
+    // of a non constant tensor which is not referenced by any other tensor
+    const auto parentEdge = getParentEdgeAt(port);
+    const auto parent = parentEdge->getParent();
+    if (parent->isConstant() || any_of(parent->getType(), Type::Input, Type::MemoryInput)) {
+        return false;
+    }
+
+    if (parent->getChildEdgesAtPort(parentEdge->getInputNum()).size() != 1) {
+        return false;
+    }
+
+    const auto* parentPd = parent->getSelectedPrimitiveDescriptor();
+    if (!parentPd) {
+        return false;
+    }
+
+    const auto& parentConfig = parentPd->getConfig();
+    const auto isInPlace = [](const PortConfig& portConfig) {
+        return portConfig.inPlace() >= 0;
+    };
+    return std::none_of(parentConfig.inConfs.begin(), parentConfig.inConfs.end(), isInPlace) &&
+           std::none_of(parentConfig.outConfs.begin(), parentConfig.outConfs.end(), isInPlace);
+}
+
+bool If::canShareOutputMemory(const std::shared_ptr<ov::Model>& body, const size_t resultIdx) {
+    const auto& results = body->get_results();
+    const auto source = results[resultIdx]->input_value(0);
+
+    // the same tensor cannot be placed into the memory of several node outputs
+    const auto sameSource = std::count_if(results.begin(), results.end(), [&source](const auto& result) {
+        return result->input_value(0) == source;
+    });
+    if (sameSource != 1) {
+        return false;
+    }
+
+    // constant results are computed once on compilation, so they must be stored in the body own memory
+    std::unordered_set<const ov::Node*> visited;
+    std::deque<const ov::Node*> toVisit{source.get_node()};
+    while (!toVisit.empty()) {
+        const auto* node = toVisit.front();
+        toVisit.pop_front();
+        if (ov::is_type<ov::op::v0::Parameter>(node)) {
+            return true;
+        }
+        if (!visited.insert(node).second) {
+            continue;
+        }
+        for (const auto& input : node->input_values()) {
+            toVisit.push_back(input.get_node());
+        }
+    }
+
+    return false;
+}
+
+void If::initBody(const bool isThen) {
+    const auto bodyIdx = isThen ? 0 : 1;
+    const auto& body = m_op->get_function(bodyIdx);
+    auto& graph = isThen ? m_thenGraph : m_elseGraph;
+    auto& inputBindings = isThen ? thenInputBindings : elseInputBindings;
+    auto& outputBindings = isThen ? thenOutputBindings : elseOutputBindings;
+    const auto& config = getSelectedPrimitiveDescriptor()->getConfig();
+
+    inputBindings.clear();
+    outputBindings.clear();
+
+    const auto& inputDescs = m_op->get_input_descriptions(bodyIdx);
+    std::vector<node::Input::InputConfig> inputConfigs(body->get_parameters().size(),
+                                                       node::Input::InputConfig{nullptr, false});
+    for (const auto& desc : inputDescs) {
+        const auto from = desc->m_input_index;
+        const auto sameInput = std::count_if(inputDescs.begin(), inputDescs.end(), [from](const auto& other) {
+            return other->m_input_index == from;
+        });
+        if (sameInput != 1 || !canShareInputMemory(from)) {
+            continue;
+        }
+
+        constexpr bool isInPlace = true;
+        inputConfigs[desc->m_body_parameter_index] =
+            node::Input::InputConfig{config.inConfs[from].getMemDesc(), isInPlace};
+        inputBindings.emplace_back(
+            PortMap{static_cast<int>(from), static_cast<int>(desc->m_body_parameter_index)});
+    }
+
+    const auto& outputDescs = m_op->get_output_descriptions(bodyIdx);
+    std::vector<node::Input::OutputConfig> outputConfigs(body->get_results().size());
+    for (const auto& desc : outputDescs) {
+        const auto resultIdx = desc->m_body_value_index;
+        const auto sameResult = std::count_if(outputDescs.begin(), outputDescs.end(), [resultIdx](const auto& other) {
+            return other->m_body_value_index == resultIdx;
+        });
+        if (sameResult != 1 || !canShareOutputMemory(body, resultIdx)) {
+            continue;
+        }
+
+        // the body converts the result to the layout and precision of the node output if they differ
+        constexpr bool isInPlace = true;
+        outputConfigs[resultIdx] = node::Input::OutputConfig{config.outConfs[desc->m_output_index].getMemDesc(),
+                                                              isInPlace};
+        outputBindings.emplace_back(PortMap{static_cast<int>(desc->m_output_index), static_cast<int>(resultIdx)});
+    }
+
+    if (outputBindings.empty()) {
+        // keep the default output configuration, which also aligns the precision of the results producers
+        outputConfigs.clear();
+    }
+
+    graph.Init(body, context, inputConfigs, outputConfigs);
+}
+
+void If::bindBodyPorts(const bool isThen) {
+    auto& graph = isThen ? m_thenGraph : m_elseGraph;
+    const auto& inputBindings = isThen ? thenInputBindings : elseInputBindings;
+    const auto& outputBindings = isThen ? thenOutputBindings : elseOutputBindings;
+
+    for (const auto& binding : inputBindings) {
+        const auto parentEdge = getParentEdgeAt(binding.from);
+        for (const auto& inputEdge : graph.getInputNodeByIndex(binding.to)->getChildEdgesAtPort(0)) {
+            CPU_NODE_ASSERT(inputEdge->getStatus() == Edge::Status::Uninitialized,
+                            "Expected Uninitialized state for edge: ",
+                            *inputEdge);
+            inputEdge->sharedMemFrom(parentEdge);
+        }
+    }
+
+    for (const auto& binding : outputBindings) {
+        const auto childEdge = getChildEdgesAtPort(binding.from).front();
+        const auto outputEdge = graph.getOutputNodeByIndex(binding.to)->getParentEdgeAt(0);
+        CPU_NODE_ASSERT(outputEdge->getStatus() == Edge::Status::Uninitialized,
+                        "Expected Uninitialized state for edge: ",
+                        *outputEdge);
+        outputEdge->sharedMemFrom(childEdge);
+    }
+}
+
+bool If::isBound(const std::vector<PortMap>& bindings, const PortMap& map_rule) {
+    return std::any_of(bindings.begin(), bindings.end(), [&map_rule](const PortMap& binding) {
+        return binding.from == map_rule.from && binding.to == map_rule.to;
+    });
+}
+
 int If::registerToAllocationContext(int offset, AllocationContext& context) {
+    bindBodyPorts(true);
+    bindBodyPorts(false);
+
     // take into account an offset of the both subgraphs
     const int thenOffset = m_thenGraph.RegisterToAllocationContext(offset, context);
     const int elseOffset = m_elseGraph.RegisterToAllocationContext(thenOffset, context);
@@ -134,8 +292,20 @@ int If::registerToAllocationContext(int offset, AllocationContext& context) {
 }
 
 void If::createPrimitive() {
-    m_thenGraph.Activate();
-    m_elseGraph.Activate();
+    if (context->getConfig().lazySubgraphActivation) {
+        // only the memory is allocated here, the body is compiled when its branch is taken for the first time
+        m_thenGraph.ActivateLazily();
+        m_elseGraph.ActivateLazily();
+        DEBUG_LOG("Deferred primitives creation for ",
+                  m_thenGraph.GetNodes().size(),
+                  " then body nodes and ",
+                  m_elseGraph.GetNodes().size(),
+                  " else body nodes of ",
+                  getName());
+    } else {
+        m_thenGraph.Activate();
+        m_elseGraph.Activate();
+    }
 
     for (const auto& param : m_op->get_then_body()->get_parameters()) {
         if (auto inNode = m_thenGraph.getInputNodeByIndex(m_op->get_then_body()->get_parameter_index(param))) {
@@ -209,7 +379,12 @@ void If::prepareBeforeMappers(const bool isThen, const dnnl::engine& eng) {
     auto& inputPortMap = isThen ? thenInputPortMap : elseInputPortMap;
     auto& inputMems = isThen ? inputMemThen : inputMemElse;
     auto& beforeMappers = isThen ? beforeThenMappers : beforeElseMappers;
+    const auto& inputBindings = isThen ? thenInputBindings : elseInputBindings;
     for (auto& map_rule : inputPortMap) {
+        if (isBound(inputBindings, map_rule)) {
+            continue;
+        }
+
         auto fromMem = getSrcMemoryAtPort(map_rule.from);
         auto& toMems = inputMems[map_rule.to];
         // Check precision between If node input/output and it's subgrapsh input/output.
@@ -230,7 +405,12 @@ void If::prepareAfterMappers(const bool isThen, const dnnl::engine& eng) {
     auto& outputPortMap = isThen ? thenOutputPortMap : elseOutputPortMap;
     auto& outputMems = isThen ? outputMemThen : outputMemElse;
     auto& afterMappers = isThen ? afterThenMappers : afterElseMappers;
+    const auto& outputBindings = isThen ? thenOutputBindings : elseOutputBindings;
     for (auto& map_rule : outputPortMap) {
+        if (isBound(outputBindings, map_rule)) {
+            continue;
+        }
+
         auto toMems = getToMemories(this, map_rule.from);
         auto& fromMem = outputMems[map_rule.to];
         // Check precision between If node input/output and it's subgrapsh input/output.
@@ -276,6 +456,18 @@ void If::execute(const dnnl::stream& strm) {
 
 void If::executeDynamicImpl(const dnnl::stream& strm) {
     execute(strm);
+
+    // the memory of the bound outputs is redefined by the body,
+    // so only the extra child edges attached to the same output ports have to be updated
+    const auto condition = static_cast<const bool>((getSrcDataAtPortAs<const uint8_t>(0))[0]);
+    const auto& outputBindings = condition ? thenOutputBindings : elseOutputBindings;
+    for (const auto& binding : outputBindings) {
+        const auto childEdges = getChildEdgesAtPort(binding.from);
+        const auto& mem = childEdges.front()->getMemoryPtr();
+        for (size_t i = 1; i < childEdges.size(); i++) {
+            childEdges[i]->getMemoryPtr()->redefineDesc(mem->getDescPtr());
+        }
+    }
 }
 
 bool If::created() const {
@@ -11,6 +11,7 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <vector>
 
 #include "allocation_context.hpp"
 #include "cpu_memory.h"
@@ -27,6 +28,7 @@ public:
 
     static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
     void initSupportedPrimitiveDescriptors() override;
+    void selectOptimalPrimitiveDescriptor() override;
     void getSupportedDescriptors() override {}
     int registerToAllocationContext(int offset, AllocationContext& context) override;
     void createPrimitive() override;
@@ -50,16 +52,21 @@ protected:
     }
 
 private:
-    void prepareBeforeMappers(bool isThen, const dnnl::engine& eng);
-    void prepareAfterMappers(bool isThen, const dnnl::engine& eng);
-
-    static std::deque<MemoryPtr> getToMemories(const Node* node, size_t port);
-
     struct PortMap {
         int from; /**< Index of external/internal out data */
         int to;   /**< Index of external/internal in data */
     };
 
+    void initBody(bool isThen);
+    void bindBodyPorts(bool isThen);
+    void prepareBeforeMappers(bool isThen, const dnnl::engine& eng);
+    void prepareAfterMappers(bool isThen, const dnnl::engine& eng);
+    [[nodiscard]] bool canShareInputMemory(size_t port) const;
+    static bool canShareOutputMemory(const std::shared_ptr<ov::Model>& body, size_t resultIdx);
+    static bool isBound(const std::vector<PortMap>& bindings, const PortMap& map_rule);
+
+    static std::deque<MemoryPtr> getToMemories(const Node* node, size_t port);
+
     class PortMapHelper {
     public:
         PortMapHelper(MemoryPtr from, std::deque<MemoryPtr> to, const dnnl::engine& eng);
@@ -85,6 +92,8 @@ private:
         afterElseMappers;
 
     std::vector<PortMap> thenInputPortMap, thenOutputPortMap, elseInputPortMap, elseOutputPortMap;
+    // ports whose memory is shared between the node and the body, so no data is copied on execution
+    std::vector<PortMap> thenInputBindings, thenOutputBindings, elseInputBindings, elseOutputBindings;
 
     std::shared_ptr<ov::op::v8::If> m_op;
 };
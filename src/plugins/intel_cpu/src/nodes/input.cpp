@@ -436,6 +436,10 @@ void Input::cloneBlobIfRequired() {
         // computations on them, thus no need to flush them to zero manually
         needFlushDenormalsToZero = false;
     }
+    if (context->getConfig().weightsSubnormalsFlushed) {
+        // the weights have been flushed on export, so there is nothing to look for
+        needFlushDenormalsToZero = false;
+    }
 
     // The presence of subnormals is better to determined at IR read time.
     auto checkSubnormalsAndBF16Overflows = [&](bool& has_subnormals, bool& has_bf16_overflows) {
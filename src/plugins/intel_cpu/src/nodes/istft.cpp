@@ -152,12 +152,11 @@ void istft_impl(const float* in_data,
     }();
     std::fill(final_result, final_result + batch_size * final_signal_length, 0.F);
 
-    std::vector<float> mid_result(batch_size * signal_length, 0.F);
-
     const auto fft_results_dim = data_shape[data_shape.size() - 3];
     OPENVINO_ASSERT(fft_results_dim == static_cast<size_t>((frame_size / 2) + 1));
 
     const auto frame_size_dim = static_cast<size_t>(frame_size);
+    const auto frame_step_dim = static_cast<size_t>(frame_step);
     const auto fft_out_shape = ov::Shape{fft_results_dim, 2};
 
     const auto window_length = window_shape[0] < frame_size_dim ? window_shape[0] : frame_size_dim;
@@ -197,50 +196,48 @@ void istft_impl(const float* in_data,
     }
 
     const auto fft_out_shape_size = shape_size(fft_out_shape);
-    const auto in_batch_single_step = num_frames * fft_out_shape_size;
     const int64_t margin = center ? (frame_size / 2) : 0;
     const int64_t data_end = signal_length - margin;
     const int64_t copy_end = final_signal_length < data_end ? final_signal_length : data_end;
 
-    std::vector<float> window_sum(batch_size * signal_length);
+    // all the frames are transformed at once, the executor applies the window to the real frames
+    std::vector<float> frames(batch_size * num_frames * frame_size_dim);
     auto twiddles = rdft_executor->generateTwiddles({static_cast<int>(frame_size)}, {frame_size_dim}, {0});
+    rdft_executor->executeFrames(data_t.data(),
+                                 frames.data(),
+                                 twiddles[0],
+                                 batch_size * num_frames,
+                                 frame_size_dim,
+                                 fft_out_shape_size,
+                                 frame_size_dim,
+                                 pad_window.data());
+
+    // the window sum is the same for all the batches
+    std::vector<float> window_sum(signal_length, 0.F);
+    for (size_t frame_idx = 0; frame_idx < num_frames; ++frame_idx) {
+        float* window_frame_sum = window_sum.data() + frame_idx * frame_step_dim;
+        for (size_t i = 0; i < frame_size_dim; ++i) {
+            window_frame_sum[i] += pow_window[i];
+        }
+    }
 
-    parallel_for(batch_size, [&](size_t batch) {
-        for (size_t frame_idx = 0; frame_idx < num_frames; ++frame_idx) {
-            size_t batch_in_start = batch * in_batch_single_step;
-            size_t batch_out_start = batch * signal_length;
-
-            const auto in_frame_start = batch_in_start + frame_idx * fft_out_shape_size;
-            const auto out_frame_start = batch_out_start + frame_idx * frame_step;
-
-            std::vector<float> frame_signal(frame_size);
-            rdft_executor->execute(data_t.data() + in_frame_start,
-                                   frame_signal.data(),
-                                   twiddles,
-                                   1,
-                                   {0},
-                                   {static_cast<int>(frame_size)},
-                                   {frame_size_dim},
-                                   {frame_size_dim},
-                                   {1},
-                                   {1});
-
-            // Overlap Add
-            float* mid_result_sum = mid_result.data() + out_frame_start;
-            float* window_frame_sum = window_sum.data() + out_frame_start;
-            for (size_t i = 0; i < frame_signal.size(); ++i) {
-                mid_result_sum[i] += frame_signal[i] * pad_window[i];
-                window_frame_sum[i] += pow_window[i];
+    // Overlap Add: each output sample gathers the frames covering it, so the blocks of samples are independent
+    const auto out_length = static_cast<size_t>(std::max<int64_t>(copy_end, 0));
+    const size_t block_size = 256;
+    parallel_for2d(batch_size, div_up(out_length, block_size), [&](size_t batch, size_t block) {
+        const float* batch_frames = frames.data() + batch * num_frames * frame_size_dim;
+        float* result = final_result + batch * final_signal_length;
+        const size_t block_end = std::min(out_length, (block + 1) * block_size);
+        for (size_t out_idx = block * block_size; out_idx < block_end; ++out_idx) {
+            const size_t idx = out_idx + static_cast<size_t>(margin);
+            const size_t first_frame = idx < frame_size_dim ? 0 : (idx - frame_size_dim) / frame_step_dim + 1;
+            const size_t last_frame = std::min(idx / frame_step_dim, num_frames - 1);
+            float sum = 0.F;
+            for (size_t frame_idx = first_frame; frame_idx <= last_frame; ++frame_idx) {
+                sum += batch_frames[frame_idx * frame_size_dim + idx - frame_idx * frame_step_dim];
             }
+            result[out_idx] = postprocess_func(sum, window_sum[idx]);
         }
-        float* result = mid_result.data() + (batch * signal_length);
-        std::transform(result,
-                       result + signal_length,
-                       window_sum.begin() + batch * signal_length,
-                       result,
-                       postprocess_func);
-        auto* const result_start = result + margin;
-        std::copy(result_start, result_start + copy_end, final_result + batch * final_signal_length);
     });
 }
 }  // namespace
@@ -1,6 +1,7 @@
 // Copyright (C) 2018-2025 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstdint>
@@ -1389,6 +1390,135 @@ static void attn_reduce(ov::float16* dst, ov::float16* temp, size_t M, size_t S,
 }
 #endif
 
+// the number of kv tokens in a work item of the kernel for the grouped query heads
+static constexpr size_t kv_block_grouped = 32;
+
+// Converts a key / value row of the cache to f32, the rows of the f32 cache are used in place
+template <typename T>
+static float* kv_row_f32(T* row,
+                         size_t n,
+                         float* buf,
+                         [[maybe_unused]] const ov::intel_cpu::PlainTensor& scale_zp,
+                         [[maybe_unused]] size_t pos,
+                         [[maybe_unused]] size_t b,
+                         [[maybe_unused]] size_t h,
+                         [[maybe_unused]] size_t group_size) {
+    if constexpr (std::is_same_v<T, float>) {
+        return row;
+    } else if constexpr (std::is_same_v<T, uint8_t>) {
+        const auto* p = scale_zp.ptr<float>(pos, b, h);
+        for (size_t group_id = 0, i = 0; i < n; group_id++) {
+            const float scale = p[group_id * 2];
+            const float zp = p[group_id * 2 + 1];
+            const size_t end = i + group_size;
+#if defined(HAVE_AVX512F)
+            auto v_scale = _mm512_set1_ps(scale);
+            auto v_zp = _mm512_set1_ps(zp);
+            for (; i + vec_len_f32_avx512 <= end; i += vec_len_f32_avx512) {
+                auto v_u8 = _mm_loadu_si128(reinterpret_cast<__m128i*>(row + i));
+                auto v_f32 = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(v_u8));
+                _mm512_storeu_ps(buf + i, _mm512_mul_ps(_mm512_sub_ps(v_f32, v_zp), v_scale));
+            }
+#elif defined(HAVE_AVX2)
+            auto v_scale = _mm256_set1_ps(scale);
+            auto v_zp = _mm256_set1_ps(zp);
+            for (; i + vec_len_f32_avx2 <= end; i += vec_len_f32_avx2) {
+                auto v_u8 = _mm_loadl_epi64(reinterpret_cast<__m128i*>(row + i));
+                auto v_f32 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(v_u8));
+                _mm256_storeu_ps(buf + i, _mm256_mul_ps(_mm256_sub_ps(v_f32, v_zp), v_scale));
+            }
+#endif
+            for (; i < end; i++) {
+                buf[i] = (static_cast<float>(row[i]) - zp) * scale;
+            }
+        }
+        return buf;
+    } else {
+        cvt_copy(buf, row, n);
+        return buf;
+    }
+}
+
+// Computes the scores of the query rows [rows, S] sharing one KV head against a key row: the key is loaded once for
+// every 4 query rows, which makes the grouped query heads a small GEMM instead of a dot product per head.
+static void dot_product_rows(float* q, size_t rows, float* k, size_t S, float* out, size_t out_stride) {
+    size_t r = 0;
+#if defined(HAVE_AVX512F)
+    for (; r + 4 <= rows; r += 4) {
+        float* q0 = q + r * S;
+        float* q1 = q0 + S;
+        float* q2 = q1 + S;
+        float* q3 = q2 + S;
+        auto vsum0 = _mm512_setzero_ps();
+        auto vsum1 = _mm512_setzero_ps();
+        auto vsum2 = _mm512_setzero_ps();
+        auto vsum3 = _mm512_setzero_ps();
+        size_t i = 0;
+        for (; i + vec_len_f32_avx512 <= S; i += vec_len_f32_avx512) {
+            auto vk = _mm512_loadu_ps(k + i);
+            vsum0 = _mm512_fmadd_ps(_mm512_loadu_ps(q0 + i), vk, vsum0);
+            vsum1 = _mm512_fmadd_ps(_mm512_loadu_ps(q1 + i), vk, vsum1);
+            vsum2 = _mm512_fmadd_ps(_mm512_loadu_ps(q2 + i), vk, vsum2);
+            vsum3 = _mm512_fmadd_ps(_mm512_loadu_ps(q3 + i), vk, vsum3);
+        }
+        float sum0 = _mm512_reduce_add_ps(vsum0);
+        float sum1 = _mm512_reduce_add_ps(vsum1);
+        float sum2 = _mm512_reduce_add_ps(vsum2);
+        float sum3 = _mm512_reduce_add_ps(vsum3);
+        for (; i < S; i++) {
+            sum0 += q0[i] * k[i];
+            sum1 += q1[i] * k[i];
+            sum2 += q2[i] * k[i];
+            sum3 += q3[i] * k[i];
+        }
+        out[r * out_stride] = sum0;
+        out[(r + 1) * out_stride] = sum1;
+        out[(r + 2) * out_stride] = sum2;
+        out[(r + 3) * out_stride] = sum3;
+    }
+#elif defined(HAVE_AVX2)
+    for (; r + 4 <= rows; r += 4) {
+        float* q0 = q + r * S;
+        float* q1 = q0 + S;
+        float* q2 = q1 + S;
+        float* q3 = q2 + S;
+        auto vsum0 = _mm256_setzero_ps();
+        auto vsum1 = _mm256_setzero_ps();
+        auto vsum2 = _mm256_setzero_ps();
+        auto vsum3 = _mm256_setzero_ps();
+        size_t i = 0;
+        for (; i + vec_len_f32_avx2 <= S; i += vec_len_f32_avx2) {
+            auto vk = _mm256_loadu_ps(k + i);
+            vsum0 = _mm256_fmadd_ps(_mm256_loadu_ps(q0 + i), vk, vsum0);
+            vsum1 = _mm256_fmadd_ps(_mm256_loadu_ps(q1 + i), vk, vsum1);
+            vsum2 = _mm256_fmadd_ps(_mm256_loadu_ps(q2 + i), vk, vsum2);
+            vsum3 = _mm256_fmadd_ps(_mm256_loadu_ps(q3 + i), vk, vsum3);
+        }
+        hsum(vsum0);
+        hsum(vsum1);
+        hsum(vsum2);
+        hsum(vsum3);
+        float sum0 = _mm256_cvtss_f32(vsum0);
+        float sum1 = _mm256_cvtss_f32(vsum1);
+        float sum2 = _mm256_cvtss_f32(vsum2);
+        float sum3 = _mm256_cvtss_f32(vsum3);
+        for (; i < S; i++) {
+            sum0 += q0[i] * k[i];
+            sum1 += q1[i] * k[i];
+            sum2 += q2[i] * k[i];
+            sum3 += q3[i] * k[i];
+        }
+        out[r * out_stride] = sum0;
+        out[(r + 1) * out_stride] = sum1;
+        out[(r + 2) * out_stride] = sum2;
+        out[(r + 3) * out_stride] = sum3;
+    }
+#endif
+    for (; r < rows; r++) {
+        out[r * out_stride] = dot_product(q + r * S, k, S, nullptr, nullptr, nullptr, 0);
+    }
+}
+
 template <typename T, typename T2, typename T3>
 static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                                     const ov::intel_cpu::PlainTensor& present_key,
@@ -1430,11 +1560,22 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
     auto nthr = parallel_get_max_threads();
     auto kv_len = present_key.size(2);
     bool pastkv_is_int8 = past_k_scale_zp;
+    // the query heads sharing a KV head convert each cached row to f32 once and compute their scores together
+    const bool grouped = std::is_same_v<T3, float> && h_each_group_len > 1 && !(quant_key_by_channel && pastkv_is_int8);
+    // per thread: the query rows of a group, a converted key / value row and the scores of the rows
+    const size_t group_rows = h_each_group_len * q_len;
+    const size_t scratch_q = 0;
+    const size_t scratch_kv = scratch_q + group_rows * S;
+    const size_t scratch_w = scratch_kv + std::max(S, SV);
+    if (grouped) {
+        // be sure no false sharing
+        head_sum.resize<float>({static_cast<size_t>(nthr), scratch_w + group_rows + 16});
+    }
 #if defined(HAVE_AVX2) && !defined(HAVE_AVX512F)
     // avx2 will pre-compute the zero point and try to save the sub instruction in the dot_product,
     //  but it seems not necessary for avx512. Possible reason may be that for avx2 the cost of dot_product
     //  is larger than the memory access time, but for avx512 is not and the cost of pre-compute is a pure increase.
-    if (pastkv_is_int8 && !quant_key_by_channel) {
+    if (pastkv_is_int8 && !quant_key_by_channel && !grouped) {
         // be sure no false sharing
         size_t group_num = S / key_group_size;
         head_sum.resize<float>({B, H, q_len, group_num + 16});
@@ -1444,112 +1585,109 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
     }
 #endif
 
-    parallel_nt_static(nthr, [&](const size_t ithr, const size_t nthr) {
-        size_t start{0};
-        size_t end{0};
-        splitter(B * h_group_num * kv_len, nthr, ithr, start, end);
-
-        size_t b = 0;
-        size_t h_group = 0;
-        size_t pk = 0;
-        if (start < end) {
-            parallel_it_init(start, pk, kv_len, b, B, h_group, h_group_num);
-            if (intel_cpu::all_of(1U, q_len, h_each_group_len)) {
-                if (B == 1) {
-                    // the memory will be continuous when b==1
-                    for (size_t iwork = start; iwork < end; ++iwork) {
-                        auto* p = past_k_scale_zp.ptr<float>(pk, 0, h_group);
-#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
-                        if (std::is_same<T3, ov::float16>::value && std::is_same<T, ov::float16>::value &&
-                            std::is_same<T2, ov::float16>::value) {
-                            auto p_k = present_key.ptr<ov::float16>(0, h_group, pk);
-                            prefetch_bytes(S, _MM_HINT_T0, 4096, p_k);
-                            auto _qk = dot_product_fp16(query.ptr<ov::float16>(0, h_group),
-                                                        p_k,
-                                                        S,
-                                                        p,
-                                                        p + 1,
-                                                        head_sum.ptr<float>(0, h_group));
-                            buf_attn_w.ptr<T3>(0, h_group, 0)[pk] = _qk;
-                            parallel_it_step(pk, kv_len, b, B, h_group, h_group_num);
-                            continue;
-                        }
-#endif
-                        if (quant_key_by_channel && pastkv_is_int8) {
-                            auto* p_scale = past_k_scale_zp.ptr<float>(pk / key_group_size * 2, 0, h_group);
-                            auto* p_zp = past_k_scale_zp.ptr<float>(pk / key_group_size * 2 + 1, 0, h_group);
-                            auto* p_k = present_key.ptr<uint8_t>(0, h_group, pk);
-                            prefetch_bytes(S, _MM_HINT_T0, 4096, p_k);
-                            buf_attn_w.ptr<T3>(0, h_group, 0)[pk] =
-                                dot_product_by_channel(query.ptr<T>(0, h_group), p_k, S, p_scale, p_zp, key_group_size);
-                        } else {
-                            auto p_k = present_key.ptr<T2>(0, h_group, pk);
-                            prefetch_bytes(S, _MM_HINT_T0, 4096, p_k);
-                            buf_attn_w.ptr<T3>(0, h_group, 0)[pk] = dot_product(query.ptr<T>(0, h_group),
-                                                                                p_k,
-                                                                                S,
-                                                                                p,
-                                                                                p + 1,
-                                                                                head_sum.ptr<float>(0, h_group),
-                                                                                key_group_size);
-                        }
-                        parallel_it_step(pk, kv_len, b, B, h_group, h_group_num);
+    if (grouped) {
+        const size_t kv_blocks = (kv_len + kv_block_grouped - 1) / kv_block_grouped;
+        parallel_for3d(B, h_group_num, kv_blocks, [&](size_t b, size_t h_group, size_t blk) {
+            auto* scratch = head_sum.ptr<float>(parallel_get_thread_num());
+            auto* q_f32 = scratch + scratch_q;
+            auto* scores = scratch + scratch_w;
+            for (size_t g = 0; g < h_each_group_len; g++) {
+                for (size_t pq = 0; pq < q_len; pq++) {
+                    cvt_copy(q_f32 + (g * q_len + pq) * S, query.ptr<T>(b, h_group * h_each_group_len + g, pq), S);
+                }
+            }
+            const size_t pk_end = std::min(kv_len, (blk + 1) * kv_block_grouped);
+            for (size_t pk = blk * kv_block_grouped; pk < pk_end; pk++) {
+                auto b_kv = beams ? beams.ptr<int32_t>(b)[pk] : b;
+                auto* k = kv_row_f32(present_key.ptr<T2>(b_kv, h_group, pk),
+                                     S,
+                                     scratch + scratch_kv,
+                                     past_k_scale_zp,
+                                     pk,
+                                     b_kv,
+                                     h_group,
+                                     key_group_size);
+                dot_product_rows(q_f32, group_rows, k, S, scores, 1);
+                for (size_t g = 0; g < h_each_group_len; g++) {
+                    for (size_t pq = 0; pq < q_len; pq++) {
+                        buf_attn_w.ptr<float>(b, h_group * h_each_group_len + g, pq)[pk] = scores[g * q_len + pq];
                     }
-                } else {
-                    for (size_t iwork = start; iwork < end; ++iwork) {
-                        auto b_kv = beams ? beams.ptr<int32_t>(b)[pk] : b;
-                        auto* p = past_k_scale_zp.ptr<float>(pk, b_kv, h_group);
+                }
+            }
+        });
+    } else {
+        parallel_nt_static(nthr, [&](const size_t ithr, const size_t nthr) {
+            size_t start{0};
+            size_t end{0};
+            splitter(B * h_group_num * kv_len, nthr, ithr, start, end);
+
+            size_t b = 0;
+            size_t h_group = 0;
+            size_t pk = 0;
+            if (start < end) {
+                parallel_it_init(start, pk, kv_len, b, B, h_group, h_group_num);
+                if (intel_cpu::all_of(1U, q_len, h_each_group_len)) {
+                    if (B == 1) {
+                        // the memory will be continuous when b==1
+                        for (size_t iwork = start; iwork < end; ++iwork) {
+                            auto* p = past_k_scale_zp.ptr<float>(pk, 0, h_group);
 #if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
-                        if (std::is_same<T3, ov::float16>::value && std::is_same<T, ov::float16>::value &&
-                            std::is_same<T2, ov::float16>::value) {
-                            auto p_k = present_key.ptr<ov::float16>(b_kv, h_group, pk);
-                            auto _qk = dot_product_fp16(query.ptr<ov::float16>(b, h_group),
-                                                        p_k,
-                                                        S,
-                                                        p,
-                                                        p + 1,
-                                                        head_sum.ptr<float>(b, h_group));
-                            buf_attn_w.ptr<T3>(b, h_group, 0)[pk] = _qk;
-                            parallel_it_step(pk, kv_len, b, B, h_group, h_group_num);
-                            continue;
-                        }
+                            if (std::is_same<T3, ov::float16>::value && std::is_same<T, ov::float16>::value &&
+                                std::is_same<T2, ov::float16>::value) {
+                                auto p_k = present_key.ptr<ov::float16>(0, h_group, pk);
+                                prefetch_bytes(S, _MM_HINT_T0, 4096, p_k);
+                                auto _qk = dot_product_fp16(query.ptr<ov::float16>(0, h_group),
+                                                            p_k,
+                                                            S,
+                                                            p,
+                                                            p + 1,
+                                                            head_sum.ptr<float>(0, h_group));
+                                buf_attn_w.ptr<T3>(0, h_group, 0)[pk] = _qk;
+                                parallel_it_step(pk, kv_len, b, B, h_group, h_group_num);
+                                continue;
+                            }
 #endif
-                        if (quant_key_by_channel && pastkv_is_int8) {
-                            auto* p_scale = past_k_scale_zp.ptr<float>(pk / key_group_size * 2, b_kv, h_group);
-                            auto* p_zp = past_k_scale_zp.ptr<float>(pk / key_group_size * 2 + 1, b_kv, h_group);
-                            auto* p_k = present_key.ptr<uint8_t>(b_kv, h_group, pk);
-                            buf_attn_w.ptr<T3>(b, h_group, 0)[pk] =
-                                dot_product_by_channel(query.ptr<T>(b, h_group), p_k, S, p_scale, p_zp, key_group_size);
-                        } else {
-                            auto p_k = present_key.ptr<T2>(b_kv, h_group, pk);
-                            buf_attn_w.ptr<T3>(b, h_group, 0)[pk] = dot_product(query.ptr<T>(b, h_group),
-                                                                                p_k,
-                                                                                S,
-                                                                                p,
-                                                                                p + 1,
-                                                                                head_sum.ptr<float>(b, h_group),
-                                                                                key_group_size);
+                            if (quant_key_by_channel && pastkv_is_int8) {
+                                auto* p_scale = past_k_scale_zp.ptr<float>(pk / key_group_size * 2, 0, h_group);
+                                auto* p_zp = past_k_scale_zp.ptr<float>(pk / key_group_size * 2 + 1, 0, h_group);
+                                auto* p_k = present_key.ptr<uint8_t>(0, h_group, pk);
+                                prefetch_bytes(S, _MM_HINT_T0, 4096, p_k);
+                                buf_attn_w.ptr<T3>(0, h_group, 0)[pk] =
+                                    dot_product_by_channel(query.ptr<T>(0, h_group),
+                                                           p_k,
+                                                           S,
+                                                           p_scale,
+                                                           p_zp,
+                                                           key_group_size);
+                            } else {
+                                auto p_k = present_key.ptr<T2>(0, h_group, pk);
+                                prefetch_bytes(S, _MM_HINT_T0, 4096, p_k);
+                                buf_attn_w.ptr<T3>(0, h_group, 0)[pk] = dot_product(query.ptr<T>(0, h_group),
+                                                                                    p_k,
+                                                                                    S,
+                                                                                    p,
+                                                                                    p + 1,
+                                                                                    head_sum.ptr<float>(0, h_group),
+                                                                                    key_group_size);
+                            }
+                            parallel_it_step(pk, kv_len, b, B, h_group, h_group_num);
                         }
-                        parallel_it_step(pk, kv_len, b, B, h_group, h_group_num);
-                    }
-                }
-            } else {
-                for (size_t iwork = start; iwork < end; ++iwork) {
-                    auto b_kv = beams ? beams.ptr<int32_t>(b)[pk] : b;
-                    for (size_t pq = 0; pq < q_len; pq++) {
-                        auto* p = past_k_scale_zp.ptr<float>(pk, b_kv, h_group);
-                        for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
+                    } else {
+                        for (size_t iwork = start; iwork < end; ++iwork) {
+                            auto b_kv = beams ? beams.ptr<int32_t>(b)[pk] : b;
+                            auto* p = past_k_scale_zp.ptr<float>(pk, b_kv, h_group);
 #if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
                             if (std::is_same<T3, ov::float16>::value && std::is_same<T, ov::float16>::value &&
                                 std::is_same<T2, ov::float16>::value) {
                                 auto p_k = present_key.ptr<ov::float16>(b_kv, h_group, pk);
-                                auto _qk = dot_product_fp16(query.ptr<ov::float16>(b, h, pq),
+                                auto _qk = dot_product_fp16(query.ptr<ov::float16>(b, h_group),
                                                             p_k,
                                                             S,
                                                             p,
                                                             p + 1,
-                                                            head_sum.ptr<float>(b, h, pq));
-                                buf_attn_w.ptr<T3>(b, h, pq)[pk] = _qk;
+                                                            head_sum.ptr<float>(b, h_group));
+                                buf_attn_w.ptr<T3>(b, h_group, 0)[pk] = _qk;
+                                parallel_it_step(pk, kv_len, b, B, h_group, h_group_num);
                                 continue;
                             }
 #endif
@@ -1557,28 +1695,74 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                                 auto* p_scale = past_k_scale_zp.ptr<float>(pk / key_group_size * 2, b_kv, h_group);
                                 auto* p_zp = past_k_scale_zp.ptr<float>(pk / key_group_size * 2 + 1, b_kv, h_group);
                                 auto* p_k = present_key.ptr<uint8_t>(b_kv, h_group, pk);
-                                buf_attn_w.ptr<T3>(b, h, pq)[pk] = dot_product_by_channel(query.ptr<T>(b, h, pq),
-                                                                                          p_k,
-                                                                                          S,
-                                                                                          p_scale,
-                                                                                          p_zp,
-                                                                                          key_group_size);
+                                buf_attn_w.ptr<T3>(b, h_group, 0)[pk] =
+                                    dot_product_by_channel(query.ptr<T>(b, h_group),
+                                                           p_k,
+                                                           S,
+                                                           p_scale,
+                                                           p_zp,
+                                                           key_group_size);
                             } else {
-                                buf_attn_w.ptr<T3>(b, h, pq)[pk] = dot_product(query.ptr<T>(b, h, pq),
-                                                                               present_key.ptr<T2>(b_kv, h_group, pk),
-                                                                               S,
-                                                                               p,
-                                                                               p + 1,
-                                                                               head_sum.ptr<float>(b, h, pq),
-                                                                               key_group_size);
+                                auto p_k = present_key.ptr<T2>(b_kv, h_group, pk);
+                                buf_attn_w.ptr<T3>(b, h_group, 0)[pk] = dot_product(query.ptr<T>(b, h_group),
+                                                                                    p_k,
+                                                                                    S,
+                                                                                    p,
+                                                                                    p + 1,
+                                                                                    head_sum.ptr<float>(b, h_group),
+                                                                                    key_group_size);
                             }
+                            parallel_it_step(pk, kv_len, b, B, h_group, h_group_num);
                         }
                     }
-                    parallel_it_step(pk, kv_len, b, B, h_group, h_group_num);
+                } else {
+                    for (size_t iwork = start; iwork < end; ++iwork) {
+                        auto b_kv = beams ? beams.ptr<int32_t>(b)[pk] : b;
+                        for (size_t pq = 0; pq < q_len; pq++) {
+                            auto* p = past_k_scale_zp.ptr<float>(pk, b_kv, h_group);
+                            for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+                                if (std::is_same<T3, ov::float16>::value && std::is_same<T, ov::float16>::value &&
+                                    std::is_same<T2, ov::float16>::value) {
+                                    auto p_k = present_key.ptr<ov::float16>(b_kv, h_group, pk);
+                                    auto _qk = dot_product_fp16(query.ptr<ov::float16>(b, h, pq),
+                                                                p_k,
+                                                                S,
+                                                                p,
+                                                                p + 1,
+                                                                head_sum.ptr<float>(b, h, pq));
+                                    buf_attn_w.ptr<T3>(b, h, pq)[pk] = _qk;
+                                    continue;
+                                }
+#endif
+                                if (quant_key_by_channel && pastkv_is_int8) {
+                                    auto* p_scale = past_k_scale_zp.ptr<float>(pk / key_group_size * 2, b_kv, h_group);
+                                    auto* p_zp = past_k_scale_zp.ptr<float>(pk / key_group_size * 2 + 1, b_kv, h_group);
+                                    auto* p_k = present_key.ptr<uint8_t>(b_kv, h_group, pk);
+                                    buf_attn_w.ptr<T3>(b, h, pq)[pk] = dot_product_by_channel(query.ptr<T>(b, h, pq),
+                                                                                              p_k,
+                                                                                              S,
+                                                                                              p_scale,
+                                                                                              p_zp,
+                                                                                              key_group_size);
+                                } else {
+                                    buf_attn_w.ptr<T3>(b, h, pq)[pk] =
+                                        dot_product(query.ptr<T>(b, h, pq),
+                                                    present_key.ptr<T2>(b_kv, h_group, pk),
+                                                    S,
+                                                    p,
+                                                    p + 1,
+                                                    head_sum.ptr<float>(b, h, pq),
+                                                    key_group_size);
+                                }
+                            }
+                        }
+                        parallel_it_step(pk, kv_len, b, B, h_group, h_group_num);
+                    }
                 }
             }
-        }
-    });
+        });
+    }
 
     parallel_for3d(B, H, q_len, [&](size_t b, size_t h, size_t pq) {
         auto cur_kv_len = kv_len;
@@ -1614,6 +1798,30 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
             for (size_t pv = 0; pv < kv_len; pv++) {
                 auto b_kv = beams ? beams.ptr<int32_t>(b)[pv] : b;
                 auto* v = present_value.ptr<T2>(b_kv, h_group, pv);
+                if (grouped) {
+                    auto* v_f32 = kv_row_f32(v,
+                                             SV,
+                                             head_sum.ptr<float>(ithr) + scratch_kv,
+                                             past_v_scale_zp,
+                                             pv,
+                                             b_kv,
+                                             h_group,
+                                             value_group_size);
+                    for (size_t pq = 0; pq < q_len; pq++) {
+                        for (size_t h = h_group * h_each_group_len, group_idx = 0;
+                             h < (h_group + 1) * h_each_group_len;
+                             h++, group_idx++) {
+                            attn_acc_value(buf_attn_score.ptr<float>(ithr, pq, group_idx),
+                                           buf_attn_w.ptr<float>(b, h, pq)[pv],
+                                           v_f32,
+                                           SV,
+                                           nullptr,
+                                           nullptr,
+                                           0);
+                        }
+                    }
+                    continue;
+                }
                 auto* p = past_v_scale_zp.ptr<float>(pv, b_kv, h_group);
                 for (size_t pq = 0; pq < q_len; pq++) {
                     for (size_t h = h_group * h_each_group_len, group_idx = 0; h < (h_group + 1) * h_each_group_len;
@@ -1672,6 +1880,29 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                 for (size_t iwork = start; iwork < end; ++iwork) {
                     auto b_kv = beams ? beams.ptr<int32_t>(b)[pv] : b;
                     auto* v = present_value.ptr<T2>(b_kv, h_group, pv);
+                    if (grouped) {
+                        auto* v_f32 = kv_row_f32(v,
+                                                 SV,
+                                                 head_sum.ptr<float>(ithr) + scratch_kv,
+                                                 past_v_scale_zp,
+                                                 pv,
+                                                 b_kv,
+                                                 h_group,
+                                                 value_group_size);
+                        for (size_t pq = 0; pq < q_len; pq++) {
+                            for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
+                                attn_acc_value(buf_attn_score.ptr<float>(ithr, b, pq, h),
+                                               buf_attn_w.ptr<float>(b, h, pq)[pv],
+                                               v_f32,
+                                               SV,
+                                               nullptr,
+                                               nullptr,
+                                               0);
+                            }
+                        }
+                        parallel_it_step(pv, kv_len, b, B, h_group, h_group_num);
+                        continue;
+                    }
                     auto* p = past_v_scale_zp.ptr<float>(pv, b_kv, h_group);
                     for (size_t pq = 0; pq < q_len; pq++) {
                         for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
@@ -62,4 +62,31 @@ void attn_softmax(void* a,
                                dst_precision);
 }
 
+float attn_softmax_online(float* a,
+                          void* a_dst,
+                          float scale,
+                          void* attn_mask,
+                          uint8_t* causal_mask,
+                          bool select_nfltmax_at_0,
+                          size_t len,
+                          size_t total_size,
+                          float& max,
+                          float& sum,
+                          ov::element::Type attn_mask_prec,
+                          ov::element::Type dst_precision) {
+    return attn_softmax_online_kernel(a,
+                                      a_dst,
+                                      scale,
+                                      nullptr,
+                                      attn_mask,
+                                      causal_mask,
+                                      select_nfltmax_at_0,
+                                      len,
+                                      total_size,
+                                      max,
+                                      sum,
+                                      attn_mask_prec,
+                                      dst_precision);
+}
+
 }  // namespace ov::Extensions::Cpu::XARCH
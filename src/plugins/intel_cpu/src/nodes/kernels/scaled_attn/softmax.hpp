@@ -22,4 +22,18 @@ void attn_softmax(void* a,
                   ov::element::Type attn_mask_prec,
                   ov::element::Type dst_precision);
 
+// online softmax step over a block of keys, returns the factor to rescale the previous partial results with
+float attn_softmax_online(float* a,
+                          void* a_dst,
+                          float scale,
+                          void* attn_mask,
+                          uint8_t* causal_mask,
+                          bool select_nfltmax_at_0,
+                          size_t len,
+                          size_t total_size,
+                          float& max,
+                          float& sum,
+                          ov::element::Type attn_mask_prec,
+                          ov::element::Type dst_precision);
+
 }  // namespace ov::Extensions::Cpu::XARCH
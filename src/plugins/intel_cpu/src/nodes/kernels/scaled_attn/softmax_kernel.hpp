@@ -3,6 +3,7 @@
 //
 #pragma once
 
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstddef>
@@ -1070,19 +1071,16 @@ inline void attn_softmax_kernel(T* a,
                                 ov::element::Type dst_precision,
                                 float alibi_slope = 0);
 
-template <>
-inline void attn_softmax_kernel<float>(float* a,
-                                       void* a_dst,
+inline void attn_scale_mask_reduce_max(float* a,
                                        float scale,
                                        float* alibi,
                                        void* attn_mask,
                                        uint8_t* causal_mask,
                                        bool select_nfltmax_at_0,
                                        size_t len,
-                                       size_t total_size,
                                        ov::element::Type attn_mask_prec,
-                                       ov::element::Type dst_precision,
-                                       float alibi_slope) {
+                                       float alibi_slope,
+                                       float& max) {
     using func_fp32_type =
         void (*)(float*, float, const float*, const float*, const uint8_t*, bool, size_t, float, float&);
     using func_bf16_type =
@@ -1114,7 +1112,6 @@ inline void attn_softmax_kernel<float>(float* a,
                                                   scale_add2_reduce_max<true, true, false>,
                                                   scale_add2_reduce_max<true, true, true>};
     int dispatch = (alibi ? 0b100 : 0) | (attn_mask ? 0b010 : 0) | (causal_mask ? 0b001 : 0);
-    float max = std::numeric_limits<float>::lowest();
     if (attn_mask_prec == ov::element::f32) {
         funcs_fp32[dispatch](a,
                              scale,
@@ -1146,12 +1143,15 @@ inline void attn_softmax_kernel<float>(float* a,
                             alibi_slope,
                             max);
     }
+}
 
-    float sum = 0.0f;
-    // exp sum
-    exp_reduce_sum(a, max, len, sum);
-    // divide sum
-    float scalar = 1.0f / sum;
+// a_dst[0:len] = a[0:len] * scalar, a_dst[len:total_size] = 0
+inline void attn_scale_store(float* a,
+                             void* a_dst,
+                             float scalar,
+                             size_t len,
+                             size_t total_size,
+                             ov::element::Type dst_precision) {
     if (dst_precision == ov::element::f32) {
         multiply_scalar(a, reinterpret_cast<float*>(a_dst), scalar, len);
         // apply causual mask to final result instead of attn_score
@@ -1172,6 +1172,77 @@ inline void attn_softmax_kernel<float>(float* a,
         }
     }
 }
+
+template <>
+inline void attn_softmax_kernel<float>(float* a,
+                                       void* a_dst,
+                                       float scale,
+                                       float* alibi,
+                                       void* attn_mask,
+                                       uint8_t* causal_mask,
+                                       bool select_nfltmax_at_0,
+                                       size_t len,
+                                       size_t total_size,
+                                       ov::element::Type attn_mask_prec,
+                                       ov::element::Type dst_precision,
+                                       float alibi_slope) {
+    float max = std::numeric_limits<float>::lowest();
+    attn_scale_mask_reduce_max(a,
+                               scale,
+                               alibi,
+                               attn_mask,
+                               causal_mask,
+                               select_nfltmax_at_0,
+                               len,
+                               attn_mask_prec,
+                               alibi_slope,
+                               max);
+
+    float sum = 0.0f;
+    // exp sum
+    exp_reduce_sum(a, max, len, sum);
+    // divide sum
+    attn_scale_store(a, a_dst, 1.0f / sum, len, total_size, dst_precision);
+}
+
+// One step of the online softmax over a block of the row: the running max and sum of the row are updated with
+// the block, and a_dst gets exp(a - max) which is not normalized yet. The returned factor rescales everything
+// accumulated with the previous max, the final result has to be divided by the sum.
+inline float attn_softmax_online_kernel(float* a,
+                                        void* a_dst,
+                                        float scale,
+                                        float* alibi,
+                                        void* attn_mask,
+                                        uint8_t* causal_mask,
+                                        bool select_nfltmax_at_0,
+                                        size_t len,
+                                        size_t total_size,
+                                        float& max,
+                                        float& sum,
+                                        ov::element::Type attn_mask_prec,
+                                        ov::element::Type dst_precision) {
+    float block_max = std::numeric_limits<float>::lowest();
+    attn_scale_mask_reduce_max(a,
+                               scale,
+                               alibi,
+                               attn_mask,
+                               causal_mask,
+                               select_nfltmax_at_0,
+                               len,
+                               attn_mask_prec,
+                               0.0f,
+                               block_max);
+    const float new_max = std::max(max, block_max);
+    const float rescale = std::exp(max - new_max);
+
+    float block_sum = 0.0f;
+    exp_reduce_sum(a, new_max, len, block_sum);
+    sum = sum * rescale + block_sum;
+    max = new_max;
+    attn_scale_store(a, a_dst, 1.0f, len, total_size, dst_precision);
+    return rescale;
+}
+
 #if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
 template <>
 inline void attn_softmax_kernel<ov::float16>(ov::float16* a,
@@ -0,0 +1,255 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dyn_quant_gemm.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(HAVE_AVX2)
+#    include <immintrin.h>
+
+#    include "nodes/kernels/scaled_attn/common.hpp"
+#endif
+
+namespace ov::Extensions::Cpu::XARCH {
+
+static constexpr size_t n_blk = 8;
+static constexpr size_t max_rows = 4;
+
+void dq_fc_quantize_src(const float* src,
+                        size_t src_stride,
+                        uint8_t* dst,
+                        size_t dst_stride,
+                        size_t rows,
+                        size_t K,
+                        size_t block,
+                        float* scales,
+                        int32_t* sums) {
+    const size_t blocks = K / block;
+    for (size_t m = 0; m < rows; m++, src += src_stride, dst += dst_stride, scales += blocks, sums += blocks) {
+        for (size_t b = 0; b < blocks; b++) {
+            const float* a = src + b * block;
+            uint8_t* q = dst + b * block;
+            size_t k = 0;
+            float amax = 0.0F;
+#if defined(HAVE_AVX2)
+            const auto sign_mask = _mm256_set1_ps(-0.0F);
+            auto v_max = _mm256_setzero_ps();
+            for (; k + vec_len_f32_avx2 <= block; k += vec_len_f32_avx2) {
+                v_max = _mm256_max_ps(v_max, _mm256_andnot_ps(sign_mask, _mm256_loadu_ps(a + k)));
+            }
+            hmax(v_max);
+            amax = _mm256_cvtss_f32(v_max);
+#endif
+            for (; k < block; k++) {
+                amax = std::max(amax, std::abs(a[k]));
+            }
+
+            const float inv_scale = amax > 0.0F ? 127.0F / amax : 0.0F;
+            scales[b] = amax / 127.0F;
+
+            int32_t sum = 0;
+            k = 0;
+#if defined(HAVE_AVX2)
+            const auto v_inv_scale = _mm256_set1_ps(inv_scale);
+            const auto v_shift = _mm_set1_epi8(static_cast<char>(0x80));
+            auto v_sum = _mm256_setzero_si256();
+            for (; k + vec_len_f32_avx2 <= block; k += vec_len_f32_avx2) {
+                const auto v_q = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(a + k), v_inv_scale));
+                v_sum = _mm256_add_epi32(v_sum, v_q);
+                const auto v_i16 = _mm_packs_epi32(_mm256_castsi256_si128(v_q), _mm256_extracti128_si256(v_q, 1));
+                const auto v_u8 = _mm_xor_si128(_mm_packs_epi16(v_i16, v_i16), v_shift);
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(q + k), v_u8);
+            }
+            int32_t partial[vec_len_f32_avx2];
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(partial), v_sum);
+            for (const auto p : partial) {
+                sum += p;
+            }
+#endif
+            for (; k < block; k++) {
+                const auto v = static_cast<int32_t>(std::nearbyint(a[k] * inv_scale));
+                sum += v;
+                q[k] = static_cast<uint8_t>(v + 128);
+            }
+            sums[b] = sum;
+        }
+    }
+}
+
+#if defined(HAVE_AVX2)
+template <int ROWS>
+static void dq_fc_gemm_block(const uint8_t* src,
+                             size_t src_stride,
+                             const float* src_scales,
+                             const int32_t* src_sums,
+                             const uint8_t* weights,
+                             const float* w_scales,
+                             const int32_t* w_zp,
+                             const int32_t* w_comp,
+                             size_t K,
+                             size_t block,
+                             size_t group,
+                             const float* bias,
+                             float* dst,
+                             size_t dst_stride,
+                             size_t n_valid) {
+    const size_t blocks = K / block;
+    const auto low_mask = _mm256_set1_epi8(0x0F);
+    const auto ones = _mm256_set1_epi16(1);
+
+    __m256 acc[ROWS];
+    for (int r = 0; r < ROWS; r++) {
+        acc[r] = _mm256_setzero_ps();
+    }
+
+    for (size_t b = 0; b < blocks; b++) {
+        __m256i iacc[ROWS];
+        for (int r = 0; r < ROWS; r++) {
+            iacc[r] = _mm256_setzero_si256();
+        }
+
+        const size_t k0 = b * block;
+        for (size_t k = k0; k < k0 + block; k += 8) {
+            // 8 output channels x 8 values of K: the low nibbles keep k + 0..3, the high nibbles keep k + 4..7
+            const auto w = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(weights + k * 4));
+            const auto w_lo = _mm256_and_si256(w, low_mask);
+            const auto w_hi = _mm256_and_si256(_mm256_srli_epi16(w, 4), low_mask);
+            for (int r = 0; r < ROWS; r++) {
+                int32_t a_lo = 0;
+                int32_t a_hi = 0;
+                std::memcpy(&a_lo, src + r * src_stride + k, sizeof(a_lo));
+                std::memcpy(&a_hi, src + r * src_stride + k + 4, sizeof(a_hi));
+                // u8 * u4 pairs don't saturate int16: 2 * 2 * 255 * 15 < 32767
+                const auto prod = _mm256_add_epi16(_mm256_maddubs_epi16(_mm256_set1_epi32(a_lo), w_lo),
+                                                   _mm256_maddubs_epi16(_mm256_set1_epi32(a_hi), w_hi));
+                iacc[r] = _mm256_add_epi32(iacc[r], _mm256_madd_epi16(prod, ones));
+            }
+        }
+
+        // sum((q + 128) * w) - 128 * sum(w) - zp * sum(q) = sum(q * (w - zp))
+        const size_t g = k0 / group;
+        const auto comp = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w_comp + b * n_blk));
+        const auto zp = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w_zp + g * n_blk));
+        const auto ws = _mm256_loadu_ps(w_scales + g * n_blk);
+        for (int r = 0; r < ROWS; r++) {
+            const auto qsum = _mm256_set1_epi32(src_sums[r * blocks + b]);
+            const auto corr = _mm256_add_epi32(comp, _mm256_mullo_epi32(zp, qsum));
+            const auto v = _mm256_cvtepi32_ps(_mm256_sub_epi32(iacc[r], corr));
+            acc[r] = _mm256_fmadd_ps(v, _mm256_mul_ps(ws, _mm256_set1_ps(src_scales[r * blocks + b])), acc[r]);
+        }
+    }
+
+    for (int r = 0; r < ROWS; r++) {
+        if (bias) {
+            acc[r] = _mm256_add_ps(acc[r], mm256_uni_loadu_tail_ps(bias, n_valid));
+        }
+        mm256_uni_storeu_tail_ps(dst + r * dst_stride, acc[r], n_valid);
+    }
+}
+#else
+static void dq_fc_gemm_block_ref(const uint8_t* src,
+                                 size_t src_stride,
+                                 const float* src_scales,
+                                 const int32_t* src_sums,
+                                 size_t rows,
+                                 const uint8_t* weights,
+                                 const float* w_scales,
+                                 const int32_t* w_zp,
+                                 const int32_t* w_comp,
+                                 size_t K,
+                                 size_t block,
+                                 size_t group,
+                                 const float* bias,
+                                 float* dst,
+                                 size_t dst_stride,
+                                 size_t n_valid) {
+    const size_t blocks = K / block;
+    for (size_t r = 0; r < rows; r++) {
+        for (size_t n = 0; n < n_valid; n++) {
+            float acc = 0.0F;
+            for (size_t b = 0; b < blocks; b++) {
+                int32_t iacc = 0;
+                for (size_t k = b * block; k < (b + 1) * block; k++) {
+                    const uint8_t packed = weights[(k / 8) * 32 + n * 4 + k % 4];
+                    const int32_t w = (k % 8) < 4 ? (packed & 0x0F) : (packed >> 4);
+                    iacc += static_cast<int32_t>(src[r * src_stride + k]) * w;
+                }
+                const size_t g = b * block / group;
+                const int32_t corr = w_comp[b * n_blk + n] + w_zp[g * n_blk + n] * src_sums[r * blocks + b];
+                acc += static_cast<float>(iacc - corr) * w_scales[g * n_blk + n] * src_scales[r * blocks + b];
+            }
+            dst[r * dst_stride + n] = bias ? acc + bias[n] : acc;
+        }
+    }
+}
+#endif
+
+void dq_fc_gemm(const uint8_t* src,
+                size_t src_stride,
+                const float* src_scales,
+                const int32_t* src_sums,
+                size_t M,
+                const uint8_t* weights,
+                const float* w_scales,
+                const int32_t* w_zp,
+                const int32_t* w_comp,
+                size_t K,
+                size_t block,
+                size_t group,
+                size_t n_begin,
+                size_t n_end,
+                const float* bias,
+                float* dst,
+                size_t dst_stride) {
+    const size_t blocks = K / block;
+    const size_t groups = K / group;
+    for (size_t n = n_begin; n < n_end; n += n_blk) {
+        const size_t nb = n / n_blk;
+        const size_t n_valid = std::min(n_blk, n_end - n);
+        const uint8_t* w = weights + nb * K * 4;
+        const float* ws = w_scales + nb * groups * n_blk;
+        const int32_t* wzp = w_zp + nb * groups * n_blk;
+        const int32_t* wcomp = w_comp + nb * blocks * n_blk;
+        const float* b = bias ? bias + n : nullptr;
+        for (size_t m = 0; m < M; m += max_rows) {
+            const size_t rows = std::min(max_rows, M - m);
+            const uint8_t* a = src + m * src_stride;
+            const float* sa = src_scales + m * blocks;
+            const int32_t* qsum = src_sums + m * blocks;
+            float* c = dst + m * dst_stride + n;
+#if defined(HAVE_AVX2)
+            using block_kernel_t = decltype(&dq_fc_gemm_block<1>);
+            static constexpr block_kernel_t kernels[max_rows] = {dq_fc_gemm_block<1>,
+                                                                 dq_fc_gemm_block<2>,
+                                                                 dq_fc_gemm_block<3>,
+                                                                 dq_fc_gemm_block<4>};
+            kernels[rows - 1](a, src_stride, sa, qsum, w, ws, wzp, wcomp, K, block, group, b, c, dst_stride, n_valid);
+#else
+            dq_fc_gemm_block_ref(a,
+                                 src_stride,
+                                 sa,
+                                 qsum,
+                                 rows,
+                                 w,
+                                 ws,
+                                 wzp,
+                                 wcomp,
+                                 K,
+                                 block,
+                                 group,
+                                 b,
+                                 c,
+                                 dst_stride,
+                                 n_valid);
+#endif
+        }
+    }
+}
+
+}  // namespace ov::Extensions::Cpu::XARCH
@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov::Extensions::Cpu::XARCH {
+
+// Quantizes the f32 activations symmetrically to int8 by blocks of `block` elements along K.
+// The values are stored as u8 shifted by 128 together with the scale and the sum of the int8 values of every block.
+void dq_fc_quantize_src(const float* src,
+                        size_t src_stride,
+                        uint8_t* dst,
+                        size_t dst_stride,
+                        size_t rows,
+                        size_t K,
+                        size_t block,
+                        float* scales,
+                        int32_t* sums);
+
+// Computes the columns [n_begin, n_end) of dst[M, N] = src[M, K] * weights[N, K]^T + bias, where
+//  - src is quantized by dq_fc_quantize_src
+//  - weights are u4 packed by the blocks of 8 output channels: [N / 8][K / 8][32 bytes],
+//    the byte j of the k8-th chunk keeps k = k8 * 8 + j % 4 (low nibble) and k8 * 8 + 4 + j % 4 (high nibble)
+//    of the output channel j / 4 of the block
+//  - w_scales / w_zp are [N / 8][K / group][8], w_comp is [N / 8][K / block][8] and keeps 128 * sum(w) over the block
+// n_begin must be a multiple of 8.
+void dq_fc_gemm(const uint8_t* src,
+                size_t src_stride,
+                const float* src_scales,
+                const int32_t* src_sums,
+                size_t M,
+                const uint8_t* weights,
+                const float* w_scales,
+                const int32_t* w_zp,
+                const int32_t* w_comp,
+                size_t K,
+                size_t block,
+                size_t group,
+                size_t n_begin,
+                size_t n_end,
+                const float* bias,
+                float* dst,
+                size_t dst_stride);
+
+}  // namespace ov::Extensions::Cpu::XARCH
@@ -0,0 +1,518 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "lm_head_sampling.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <limits>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "graph_context.h"
+#include "memory_desc/cpu_memory_desc.h"
+#include "node.h"
+#include "nodes/common/cpu_convert.h"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "shape_inference/shape_inference_cpu.hpp"
+#include "transformations/cpu_opset/common/op/lm_head_sampling.hpp"
+#include "utils/general_utils.h"
+
+#ifdef OV_CPU_WITH_MLAS
+#    include "mlas/sgemm.hpp"
+#endif
+
+namespace ov::intel_cpu::node {
+
+namespace {
+
+// the number of the vocabulary entries projected by a thread before their scores are consumed
+constexpr size_t VOCAB_TILE = 64;
+
+struct Candidate {
+    float score;
+    int32_t id;
+};
+
+// the higher score first and the lower id first among the equal scores, like TopK does
+bool better(const Candidate& a, const Candidate& b) {
+    return a.score > b.score || (a.score == b.score && a.id < b.id);
+}
+
+#ifndef OV_CPU_WITH_MLAS
+template <typename W>
+float dot(const float* a, const W* b, size_t K) {
+    float sum = 0.F;
+    for (size_t k = 0; k < K; k++) {
+        sum += a[k] * static_cast<float>(b[k]);
+    }
+    return sum;
+}
+#endif
+
+// the running log-sum-exp of the scores as max and sum(exp(score - max))
+void accumulate(float score, float& max, float& sum) {
+    if (score > max) {
+        sum = sum * std::exp(max - score) + 1.F;
+        max = score;
+    } else {
+        sum += std::exp(score - max);
+    }
+}
+
+}  // namespace
+
+template <typename W>
+struct LMHeadSampling::Executor : public LMHeadSampling::ExecutorBase {
+    LMHeadSampling* m_node;
+    const LMHeadSamplingNode::Config m_config;
+
+    // per thread and row: the top-k heap and the log-sum-exp of the scores of the thread part of the vocabulary
+    std::vector<Candidate> m_heaps;
+    std::vector<size_t> m_heapSizes;
+    std::vector<float> m_max;
+    std::vector<float> m_sum;
+    std::vector<float> m_tiles;
+    // per thread: the weights of a vocabulary tile converted to f32
+    std::vector<float> m_weightTiles;
+    // the scores of all the vocabulary, required by the nucleus sampling without top_k only
+    std::vector<float> m_scores;
+    // the sorted ids of the previous tokens per batch
+    std::vector<std::vector<int32_t>> m_penalized;
+    size_t m_rowsPerBatch = 1;
+    std::vector<float> m_random;
+
+    Executor(LMHeadSampling* node, const LMHeadSamplingNode::Config& config) : m_node(node), m_config(config) {}
+
+    void preparePenalties(size_t rows) {
+        m_penalized.clear();
+        if (m_config.repetition_penalty == 1.F) {
+            return;
+        }
+        const auto& idsMem = m_node->getSrcMemoryAtPort(m_node->getOriginalInputsNumber() - 1);
+        const auto& dims = idsMem->getStaticDims();
+        OPENVINO_ASSERT(dims.size() == 2 && dims[0] > 0 && rows % dims[0] == 0,
+                        "LMHeadSampling previous tokens shape doesn't match the batch");
+        const auto* ids = idsMem->getDataAs<const int32_t>();
+        const auto V = static_cast<int32_t>(m_config.vocab_size);
+        m_rowsPerBatch = rows / dims[0];
+        m_penalized.resize(dims[0]);
+        for (size_t b = 0; b < dims[0]; b++) {
+            auto& penalized = m_penalized[b];
+            for (size_t i = 0; i < dims[1]; i++) {
+                const auto id = ids[b * dims[1] + i];
+                if (id >= 0 && id < V) {
+                    penalized.push_back(id);
+                }
+            }
+            std::sort(penalized.begin(), penalized.end());
+            penalized.erase(std::unique(penalized.begin(), penalized.end()), penalized.end());
+        }
+    }
+
+    // out[rows, n] with the leading dimension ldo = the logits of the vocabulary entries [v0, v0 + n)
+    void project(const float* src,
+                 size_t rows,
+                 const W* weight,
+                 const float* scales,
+                 size_t v0,
+                 size_t n,
+                 float* out,
+                 size_t ldo,
+                 float* scratch) const {
+        const auto H = static_cast<size_t>(m_config.hidden_size);
+#ifdef OV_CPU_WITH_MLAS
+        const float* B = nullptr;
+        if constexpr (std::is_same_v<W, float>) {
+            B = weight + v0 * H;
+        } else {
+            // the rows of the tile are contiguous, so they are converted by one vectorized call
+            cpu_convert(weight + v0 * H, scratch, ov::element::from<W>(), ov::element::f32, n * H);
+            B = scratch;
+        }
+        mlas_sgemm("N", "T", rows, n, H, 1.F, src, H, B, H, 0.F, out, ldo, 1);
+#else
+        for (size_t r = 0; r < rows; r++) {
+            for (size_t i = 0; i < n; i++) {
+                out[r * ldo + i] = dot(src + r * H, weight + (v0 + i) * H, H);
+            }
+        }
+#endif
+        if (scales) {
+            for (size_t r = 0; r < rows; r++) {
+                for (size_t i = 0; i < n; i++) {
+                    out[r * ldo + i] *= scales[v0 + i];
+                }
+            }
+        }
+    }
+
+    float* weightTile(size_t ithr) {
+        return std::is_same_v<W, float> ? nullptr : &m_weightTiles[ithr * VOCAB_TILE * m_config.hidden_size];
+    }
+
+    // logits of the vocabulary entries [v0, v0 + n) -> scores
+    void score(size_t row, size_t v0, size_t n, float* tile) const {
+        if (!m_penalized.empty()) {
+            const auto& penalized = m_penalized[row / m_rowsPerBatch];
+            const float penalty = m_config.repetition_penalty;
+            auto it = std::lower_bound(penalized.begin(), penalized.end(), static_cast<int32_t>(v0));
+            for (; it != penalized.end() && static_cast<size_t>(*it) < v0 + n; ++it) {
+                float& x = tile[*it - v0];
+                x = x < 0.F ? x * penalty : x / penalty;
+            }
+        }
+        if (m_config.temperature != 1.F) {
+            for (size_t i = 0; i < n; i++) {
+                tile[i] /= m_config.temperature;
+            }
+        }
+    }
+
+    void execute() override {
+        const auto V = static_cast<size_t>(m_config.vocab_size);
+        const auto H = static_cast<size_t>(m_config.hidden_size);
+
+        const auto& srcMem = m_node->getSrcMemoryAtPort(0);
+        const size_t rows = srcMem->getShape().getElementsCount() / H;
+        if (rows == 0) {
+            return;
+        }
+        const auto* src = srcMem->getDataAs<const float>();
+        const auto* weight = m_node->getSrcMemoryAtPort(1)->getDataAs<const W>();
+        const float* scales = m_config.quantized ? m_node->getSrcMemoryAtPort(2)->getDataAs<const float>() : nullptr;
+        float* logits = m_config.with_logits ? m_node->getDstMemoryAtPort(1)->getDataAs<float>() : nullptr;
+
+        preparePenalties(rows);
+        const size_t topK = std::min(static_cast<size_t>(m_config.top_k), V);
+        const bool fullNucleus = topK == 0 && m_config.top_p < 1.F;
+        const auto nthr = static_cast<size_t>(parallel_get_max_threads());
+        m_heaps.resize(nthr * rows * topK);
+        m_heapSizes.assign(nthr * rows, 0);
+        m_max.assign(nthr * rows, -std::numeric_limits<float>::infinity());
+        m_sum.assign(nthr * rows, 0.F);
+        m_tiles.resize(nthr * rows * VOCAB_TILE);
+        if (!std::is_same_v<W, float>) {
+            m_weightTiles.resize(nthr * VOCAB_TILE * H);
+        }
+        if (fullNucleus) {
+            m_scores.resize(rows * V);
+        }
+
+        // the vocabulary is split among the threads, each weight row is read once for all the rows
+        parallel_nt_static(static_cast<int>(nthr), [&](const size_t ithr, const size_t nthr) {
+            size_t start{0};
+            size_t end{0};
+            splitter(V, nthr, ithr, start, end);
+            float* tiles = &m_tiles[ithr * rows * VOCAB_TILE];
+            float* scratch = weightTile(ithr);
+            for (size_t v0 = start; v0 < end; v0 += VOCAB_TILE) {
+                const size_t n = std::min(VOCAB_TILE, end - v0);
+                project(src, rows, weight, scales, v0, n, tiles, VOCAB_TILE, scratch);
+                for (size_t r = 0; r < rows; r++) {
+                    float* tile = tiles + r * VOCAB_TILE;
+                    if (logits) {
+                        std::memcpy(logits + r * V + v0, tile, n * sizeof(float));
+                    }
+                    score(r, v0, n, tile);
+                    const size_t state = ithr * rows + r;
+                    if (topK > 0) {
+                        Candidate* heap = &m_heaps[state * topK];
+                        size_t& size = m_heapSizes[state];
+                        for (size_t i = 0; i < n; i++) {
+                            const Candidate candidate{tile[i], static_cast<int32_t>(v0 + i)};
+                            if (size < topK) {
+                                heap[size++] = candidate;
+                                std::push_heap(heap, heap + size, better);
+                            } else if (better(candidate, heap[0])) {
+                                std::pop_heap(heap, heap + size, better);
+                                heap[size - 1] = candidate;
+                                std::push_heap(heap, heap + size, better);
+                            }
+                        }
+                    } else {
+                        for (size_t i = 0; i < n; i++) {
+                            accumulate(tile[i], m_max[state], m_sum[state]);
+                        }
+                        if (fullNucleus) {
+                            std::memcpy(&m_scores[r * V + v0], tile, n * sizeof(float));
+                        }
+                    }
+                }
+            }
+        });
+
+        // the random numbers are generated the same way as by Multinomial
+        m_random.assign(rows, 0.F);
+        if (topK != 1) {
+            std::mt19937 gen;
+            if (all_of(0U, m_config.global_seed, m_config.op_seed)) {
+                gen.seed(std::time(nullptr));
+            } else {
+                std::seed_seq seed{m_config.global_seed, m_config.op_seed};
+                gen.seed(seed);
+            }
+            const auto gen_max = static_cast<float>(std::mt19937::max());
+            for (auto& random : m_random) {
+                random = static_cast<float>(gen()) / gen_max;
+            }
+        }
+
+        auto* dstMem = m_node->getDstMemoryAtPort(0).get();
+        auto* dst32 = m_config.output_type == ov::element::i32 ? dstMem->getDataAs<int32_t>() : nullptr;
+        auto* dst64 = m_config.output_type == ov::element::i64 ? dstMem->getDataAs<int64_t>() : nullptr;
+        ov::parallel_for(rows, [&](size_t r) {
+            int32_t token = 0;
+            if (topK > 0) {
+                token = sampleTopK(r, nthr, rows, topK);
+            } else if (fullNucleus) {
+                token = sampleNucleus(r, nthr, rows);
+            } else {
+                token = sample(r, nthr, rows, src, weight, scales, logits);
+            }
+            if (dst32) {
+                dst32[r] = token;
+            } else {
+                dst64[r] = token;
+            }
+        });
+    }
+
+    // the normalizer of exp(score - max) over all the vocabulary
+    std::pair<float, float> logSumExp(size_t r, size_t nthr, size_t rows) const {
+        float max = -std::numeric_limits<float>::infinity();
+        for (size_t t = 0; t < nthr; t++) {
+            max = std::max(max, m_max[t * rows + r]);
+        }
+        float sum = 0.F;
+        for (size_t t = 0; t < nthr; t++) {
+            sum += m_sum[t * rows + r] * std::exp(m_max[t * rows + r] - max);
+        }
+        return {max, sum};
+    }
+
+    // samples from the candidates sorted by the score with the cumulative probability cut at top_p,
+    // total is the sum of exp(score - max score) over the distribution
+    int32_t sampleSorted(size_t r, const Candidate* candidates, size_t count, float total) const {
+        if (count == 1) {
+            return candidates[0].id;
+        }
+        const float max = candidates[0].score;
+        // the smallest prefix with the probability >= top_p
+        float cumulative = 0.F;
+        size_t nucleus = count;
+        if (m_config.top_p < 1.F) {
+            for (size_t i = 0; i < count; i++) {
+                cumulative += std::exp(candidates[i].score - max);
+                if (cumulative >= m_config.top_p * total) {
+                    nucleus = i + 1;
+                    break;
+                }
+            }
+            total = cumulative;
+        }
+        cumulative = 0.F;
+        for (size_t i = 0; i < nucleus; i++) {
+            cumulative += std::exp(candidates[i].score - max);
+            if (m_random[r] <= cumulative / total) {
+                return candidates[i].id;
+            }
+        }
+        return candidates[nucleus - 1].id;
+    }
+
+    int32_t sampleTopK(size_t r, size_t nthr, size_t rows, size_t topK) {
+        // the heaps of the threads are merged, the probabilities are normalized over the top_k candidates
+        std::vector<Candidate> candidates;
+        candidates.reserve(nthr * topK);
+        for (size_t t = 0; t < nthr; t++) {
+            const size_t state = t * rows + r;
+            candidates.insert(candidates.end(),
+                              m_heaps.begin() + state * topK,
+                              m_heaps.begin() + state * topK + m_heapSizes[state]);
+        }
+        const size_t count = std::min(topK, candidates.size());
+        std::partial_sort(candidates.begin(), candidates.begin() + count, candidates.end(), better);
+        float total = 0.F;
+        for (size_t i = 0; i < count; i++) {
+            total += std::exp(candidates[i].score - candidates[0].score);
+        }
+        return sampleSorted(r, candidates.data(), count, total);
+    }
+
+    int32_t sampleNucleus(size_t r, size_t nthr, size_t rows) const {
+        const auto V = static_cast<size_t>(m_config.vocab_size);
+        const float* scores = &m_scores[r * V];
+        std::vector<Candidate> candidates(V);
+        for (size_t v = 0; v < V; v++) {
+            candidates[v] = {scores[v], static_cast<int32_t>(v)};
+        }
+        std::sort(candidates.begin(), candidates.end(), better);
+        const auto [max, sum] = logSumExp(r, nthr, rows);
+        // the sum is relative to the max score which is the first candidate
+        return sampleSorted(r, candidates.data(), V, sum * std::exp(max - candidates[0].score));
+    }
+
+    // samples in the vocabulary order like Multinomial over the softmax of the scores: the part of the vocabulary
+    // which contains the sample is found by the log-sum-exp of the threads and its scores are computed again
+    int32_t sample(size_t r,
+                   size_t nthr,
+                   size_t rows,
+                   const float* src,
+                   const W* weight,
+                   const float* scales,
+                   const float* logits) {
+        const auto V = static_cast<size_t>(m_config.vocab_size);
+        const auto H = static_cast<size_t>(m_config.hidden_size);
+        const auto [max, total] = logSumExp(r, nthr, rows);
+        const float target = m_random[r];
+        float cumulative = 0.F;
+        size_t t = 0;
+        for (; t + 1 < nthr; t++) {
+            const float part = m_sum[t * rows + r] * std::exp(m_max[t * rows + r] - max);
+            if (target <= (cumulative + part) / total) {
+                break;
+            }
+            cumulative += part;
+        }
+
+        size_t start{0};
+        size_t end{0};
+        splitter(V, static_cast<int>(nthr), static_cast<int>(t), start, end);
+        float tile[VOCAB_TILE];
+        float* scratch = weightTile(static_cast<size_t>(parallel_get_thread_num()));
+        for (size_t v0 = start; v0 < end; v0 += VOCAB_TILE) {
+            const size_t n = std::min(VOCAB_TILE, end - v0);
+            if (logits) {
+                std::memcpy(tile, logits + r * V + v0, n * sizeof(float));
+            } else {
+                project(src + r * H, 1, weight, scales, v0, n, tile, VOCAB_TILE, scratch);
+            }
+            score(r, v0, n, tile);
+            for (size_t i = 0; i < n; i++) {
+                cumulative += std::exp(tile[i] - max);
+                if (target <= cumulative / total) {
+                    return static_cast<int32_t>(v0 + i);
+                }
+            }
+        }
+        // the rounding of the cumulative probability
+        return static_cast<int32_t>(end > start ? end - 1 : V - 1);
+    }
+};
+
+LMHeadSampling::LMHeadSampling(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, NgraphShapeInferFactory(op)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
+    }
+    m_config = ov::as_type_ptr<const LMHeadSamplingNode>(op)->get_config();
+}
+
+void LMHeadSampling::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty()) {
+        return;
+    }
+
+    std::vector<PortConfigurator> inPortConfigs;
+    std::vector<PortConfigurator> outPortConfigs;
+
+    inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::f32, getInputShapeAtPort(0), false, -1);  // hidden
+    // the weights are used in the original (compressed) precision
+    inPortConfigs.emplace_back(LayoutType::ncsp,
+                               getOriginalInputPrecisionAtPort(1),
+                               getInputShapeAtPort(1),
+                               false,
+                               -1);
+    size_t port = 2;
+    if (m_config.quantized) {
+        // weight scales per OC
+        inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::f32, getInputShapeAtPort(port++), false, -1);
+    }
+    if (m_config.repetition_penalty != 1.F) {
+        // previous tokens
+        inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::i32, getInputShapeAtPort(port), false, -1);
+    }
+
+    outPortConfigs.emplace_back(LayoutType::ncsp, m_config.output_type, getOutputShapeAtPort(0), false, -1);
+    if (m_config.with_logits) {
+        outPortConfigs.emplace_back(LayoutType::ncsp, ov::element::f32, getOutputShapeAtPort(1), false, -1);
+    }
+
+    addSupportedPrimDesc(inPortConfigs, outPortConfigs, impl_desc_type::ref_any);
+}
+
+void LMHeadSampling::createPrimitive() {
+    const auto weightPrecision = getOriginalInputPrecisionAtPort(1);
+    switch (weightPrecision) {
+    case ov::element::f32:
+        m_executor = std::make_shared<Executor<float>>(this, m_config);
+        break;
+    case ov::element::f16:
+        m_executor = std::make_shared<Executor<ov::float16>>(this, m_config);
+        break;
+    case ov::element::bf16:
+        m_executor = std::make_shared<Executor<ov::bfloat16>>(this, m_config);
+        break;
+    case ov::element::i8:
+        m_executor = std::make_shared<Executor<int8_t>>(this, m_config);
+        break;
+    default:
+        break;
+    }
+    if (!m_executor) {
+        CPU_NODE_THROW("Executor creation fails with weight precision " + weightPrecision.to_string());
+    }
+}
+
+void LMHeadSampling::execute([[maybe_unused]] const dnnl::stream& strm) {
+    m_executor->execute();
+}
+
+bool LMHeadSampling::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
+                                          std::string& errorMessage) noexcept {
+    try {
+        const auto node_sampling = ov::as_type_ptr<const LMHeadSamplingNode>(op);
+        if (!node_sampling) {
+            errorMessage = "Only LMHeadSamplingNode operation is supported";
+            return false;
+        }
+
+        const auto& config = node_sampling->get_config();
+        const auto weightPrecision = op->get_input_element_type(1);
+        const bool supportedPrecision =
+            config.quantized ? weightPrecision == ov::element::i8
+                             : any_of(weightPrecision, ov::element::f32, ov::element::f16, ov::element::bf16);
+        if (!supportedPrecision) {
+            errorMessage = "LMHeadSamplingNode weight precision is not supported: " + weightPrecision.to_string();
+            return false;
+        }
+        if (!op->get_input_partial_shape(1).is_static()) {
+            errorMessage = "LMHeadSamplingNode weight shape is not static";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+}  // namespace ov::intel_cpu::node
@@ -926,10 +926,17 @@ MemStatePtr MemoryInput::makeState() const {
         state_name = state_name.substr(0, suffix_idx);
     }
 
+    // the state snapshots may share the prime buffer only if none of the consumers overwrites it in place
+    const auto childEdges = getChildEdgesAtPort(0);
+    const bool share_snapshots = std::none_of(childEdges.begin(), childEdges.end(), [](const EdgePtr& edge) {
+        return edge->modifiedInPlace() != nullptr;
+    });
+
     return std::make_shared<VariableStateDoubleBuffer>(state_name,
                                                        std::make_shared<Memory>(eng, mem_desc),
                                                        std::make_shared<Memory>(eng, mem_desc),
-                                                       original_desc);
+                                                       original_desc,
+                                                       share_snapshots);
 }
 
 std::shared_ptr<ov::Model> MemoryInput::getSubGraph() {
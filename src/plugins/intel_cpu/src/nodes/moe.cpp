@@ -0,0 +1,394 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "moe.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "graph_context.h"
+#include "memory_desc/cpu_memory_desc.h"
+#include "node.h"
+#include "nodes/common/cpu_convert.h"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "shape_inference/shape_inference_cpu.hpp"
+#include "transformations/cpu_opset/x64/op/moe.hpp"
+#include "utils/general_utils.h"
+
+#ifdef OV_CPU_WITH_MLAS
+#    include "mlas/sgemm.hpp"
+#endif
+
+namespace ov::intel_cpu::node {
+
+namespace {
+
+// the size of the per-thread f32 copy of a weight block, the block holds whole rows of the weight,
+// so it is converted from the compressed precision by one vectorized call
+constexpr size_t WEIGHT_BLOCK_ELEMENTS = 128 * 1024;
+
+#ifndef OV_CPU_WITH_MLAS
+template <typename W>
+float dot(const float* a, const W* b, size_t K) {
+    float sum = 0.F;
+    for (size_t k = 0; k < K; k++) {
+        sum += a[k] * static_cast<float>(b[k]);
+    }
+    return sum;
+}
+#endif
+
+float silu(float x) {
+    return x / (1.F + std::exp(-x));
+}
+
+// the number of the weight rows [N, K] computed by one work item
+size_t blockRows(size_t N, size_t K) {
+    return std::max<size_t>(1, std::min(N, WEIGHT_BLOCK_ELEMENTS / K));
+}
+
+}  // namespace
+
+template <typename W>
+struct MoE::Executor : public MoE::ExecutorBase {
+    MoE* m_node;
+    const MoENode::Config m_config;
+
+    // the rows routed to the experts, grouped by the expert: the source token and the routing weight of every row
+    std::vector<size_t> m_expertOffsets;
+    std::vector<size_t> m_tokens;
+    std::vector<float> m_routingWeights;
+    std::vector<float> m_src;
+    std::vector<float> m_gate;
+    std::vector<float> m_up;
+    std::vector<float> m_dst;
+    // per thread: the weight block converted to f32
+    std::vector<float> m_weightBlocks;
+    size_t m_blockElements = 0;
+
+    // a block of the output channels of an expert
+    struct WorkItem {
+        size_t expert;
+        size_t n0;
+        size_t n;
+    };
+    std::vector<WorkItem> m_items;
+
+    Executor(MoE* node, const MoENode::Config& config)
+        : m_node(node),
+          m_config(config),
+          // a single row of a weight may exceed the block size
+          m_blockElements(std::max({WEIGHT_BLOCK_ELEMENTS,
+                                    static_cast<size_t>(config.hidden_size),
+                                    static_cast<size_t>(config.intermediate_size)})) {}
+
+    // C[M, n0 : n0 + n] = A[M, K] * (weight[n0 : n0 + n, K] * scales[n0 : n0 + n])^T, ldc is the row stride of C
+    void linear(const float* A,
+                size_t M,
+                const W* weight,
+                const float* scales,
+                size_t n0,
+                size_t n,
+                size_t K,
+                float* C,
+                size_t ldc,
+                float* scratch) const {
+#ifdef OV_CPU_WITH_MLAS
+        const float* B = nullptr;
+        if constexpr (std::is_same_v<W, float>) {
+            B = weight + n0 * K;
+        } else {
+            cpu_convert(weight + n0 * K, scratch, ov::element::from<W>(), ov::element::f32, n * K);
+            B = scratch;
+        }
+        mlas_sgemm("N", "T", M, n, K, 1.F, A, K, B, K, 0.F, C + n0, ldc, 1);
+#else
+        for (size_t m = 0; m < M; m++) {
+            for (size_t i = 0; i < n; i++) {
+                C[m * ldc + n0 + i] = dot(A + m * K, weight + (n0 + i) * K, K);
+            }
+        }
+#endif
+        if (scales) {
+            for (size_t m = 0; m < M; m++) {
+                for (size_t i = n0; i < n0 + n; i++) {
+                    C[m * ldc + i] *= scales[i];
+                }
+            }
+        }
+    }
+
+    // the blocks of the N output channels of all the experts with tokens
+    void prepareItems(size_t N, size_t K) {
+        const size_t rows = blockRows(N, K);
+        m_items.clear();
+        for (size_t e = 0; e + 1 < m_expertOffsets.size(); e++) {
+            if (m_expertOffsets[e + 1] == m_expertOffsets[e]) {
+                continue;
+            }
+            for (size_t n0 = 0; n0 < N; n0 += rows) {
+                m_items.push_back({e, n0, std::min(rows, N - n0)});
+            }
+        }
+    }
+
+    // the work items of all the experts are distributed among the threads together
+    template <typename F>
+    void forEachItem(const F& body) {
+        parallel_nt_static(parallel_get_max_threads(), [&](const size_t ithr, const size_t nthr) {
+            size_t start{0};
+            size_t end{0};
+            splitter(m_items.size(), nthr, ithr, start, end);
+            float* scratch = std::is_same_v<W, float> ? nullptr : &m_weightBlocks[ithr * m_blockElements];
+            for (size_t i = start; i < end; i++) {
+                body(m_items[i], scratch);
+            }
+        });
+    }
+
+    void execute() override {
+        const auto E = static_cast<size_t>(m_config.experts);
+        const auto H = static_cast<size_t>(m_config.hidden_size);
+        const auto I = static_cast<size_t>(m_config.intermediate_size);
+
+        const auto& srcMem = m_node->getSrcMemoryAtPort(0);
+        const auto& routingMem = m_node->getSrcMemoryAtPort(1);
+        const auto T = srcMem->getStaticDims()[0];
+        const auto& routingDims = routingMem->getStaticDims();
+        OPENVINO_ASSERT(routingDims[0] == E && routingDims[1] == T,
+                        "MoE routing shape doesn't match the number of experts and tokens");
+
+        const auto* src = srcMem->getDataAs<const float>();
+        const auto* routing = routingMem->getDataAs<const float>();
+        auto* dst = m_node->getDstMemoryAtPort(0)->getDataAs<float>();
+        std::fill_n(dst, T * H, 0.F);
+
+        const auto* gate = m_node->getSrcMemoryAtPort(2)->getDataAs<const W>();
+        const auto* up = m_node->getSrcMemoryAtPort(3)->getDataAs<const W>();
+        const auto* down = m_node->getSrcMemoryAtPort(4)->getDataAs<const W>();
+        const float* gateScales = nullptr;
+        const float* upScales = nullptr;
+        const float* downScales = nullptr;
+        if (m_config.quantized) {
+            gateScales = m_node->getSrcMemoryAtPort(5)->getDataAs<const float>();
+            upScales = m_node->getSrcMemoryAtPort(6)->getDataAs<const float>();
+            downScales = m_node->getSrcMemoryAtPort(7)->getDataAs<const float>();
+        }
+
+        m_expertOffsets.assign(E + 1, 0);
+        m_tokens.clear();
+        m_routingWeights.clear();
+        for (size_t e = 0; e < E; e++) {
+            for (size_t t = 0; t < T; t++) {
+                const float weight = routing[e * T + t];
+                if (weight != 0.F) {
+                    m_tokens.push_back(t);
+                    m_routingWeights.push_back(weight);
+                }
+            }
+            m_expertOffsets[e + 1] = m_tokens.size();
+        }
+        const size_t rows = m_tokens.size();
+        // the weights of the experts without tokens are not touched
+        if (rows == 0) {
+            return;
+        }
+
+        m_src.resize(rows * H);
+        m_gate.resize(rows * I);
+        m_up.resize(rows * I);
+        m_dst.resize(rows * H);
+        if (!std::is_same_v<W, float>) {
+            m_weightBlocks.resize(static_cast<size_t>(parallel_get_max_threads()) * m_blockElements);
+        }
+
+        ov::parallel_for(rows, [&](size_t r) {
+            std::memcpy(&m_src[r * H], src + m_tokens[r] * H, H * sizeof(float));
+        });
+
+        prepareItems(I, H);
+        forEachItem([&](const WorkItem& item, float* scratch) {
+            const size_t offset = m_expertOffsets[item.expert];
+            const size_t M = m_expertOffsets[item.expert + 1] - offset;
+            const float* A = &m_src[offset * H];
+            const size_t e = item.expert;
+            float* gateOut = &m_gate[offset * I];
+            float* upOut = &m_up[offset * I];
+            linear(A,
+                   M,
+                   gate + e * I * H,
+                   gateScales ? gateScales + e * I : nullptr,
+                   item.n0,
+                   item.n,
+                   H,
+                   gateOut,
+                   I,
+                   scratch);
+            linear(A,
+                   M,
+                   up + e * I * H,
+                   upScales ? upScales + e * I : nullptr,
+                   item.n0,
+                   item.n,
+                   H,
+                   upOut,
+                   I,
+                   scratch);
+            for (size_t m = 0; m < M; m++) {
+                for (size_t i = m * I + item.n0; i < m * I + item.n0 + item.n; i++) {
+                    gateOut[i] = silu(gateOut[i]) * upOut[i];
+                }
+            }
+        });
+
+        prepareItems(H, I);
+        forEachItem([&](const WorkItem& item, float* scratch) {
+            const size_t offset = m_expertOffsets[item.expert];
+            const size_t M = m_expertOffsets[item.expert + 1] - offset;
+            const size_t e = item.expert;
+            linear(&m_gate[offset * I],
+                   M,
+                   down + e * H * I,
+                   downScales ? downScales + e * H : nullptr,
+                   item.n0,
+                   item.n,
+                   I,
+                   &m_dst[offset * H],
+                   H,
+                   scratch);
+        });
+
+        // a token may be routed to several experts, so the hidden dimension is split among the threads and
+        // the rows are accumulated in the experts order
+        parallel_nt_static(parallel_get_max_threads(), [&](const size_t ithr, const size_t nthr) {
+            size_t start{0};
+            size_t end{0};
+            splitter(H, nthr, ithr, start, end);
+            for (size_t r = 0; r < rows; r++) {
+                auto* out = dst + m_tokens[r] * H;
+                const auto* expertOut = &m_dst[r * H];
+                for (size_t h = start; h < end; h++) {
+                    out[h] += m_routingWeights[r] * expertOut[h];
+                }
+            }
+        });
+    }
+};
+
+MoE::MoE(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, NgraphShapeInferFactory(op)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
+    }
+    m_config = ov::as_type_ptr<const MoENode>(op)->get_config();
+}
+
+void MoE::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty()) {
+        return;
+    }
+
+    std::vector<PortConfigurator> inPortConfigs;
+    std::vector<PortConfigurator> outPortConfigs;
+
+    inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::f32, getInputShapeAtPort(0), false, -1);  // input
+    inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::f32, getInputShapeAtPort(1), false, -1);  // routing
+    // gate, up, down weights are used in the original (compressed) precision
+    for (size_t port = 2; port < 5; port++) {
+        inPortConfigs.emplace_back(LayoutType::ncsp,
+                                   getOriginalInputPrecisionAtPort(port),
+                                   getInputShapeAtPort(port),
+                                   false,
+                                   -1);
+    }
+    if (m_config.quantized) {
+        // weight scales per OC
+        for (size_t port = 5; port < 8; port++) {
+            inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::f32, getInputShapeAtPort(port), false, -1);
+        }
+    }
+
+    outPortConfigs.emplace_back(LayoutType::ncsp, ov::element::f32, getOutputShapeAtPort(0), false, -1);
+
+    addSupportedPrimDesc(inPortConfigs, outPortConfigs, impl_desc_type::ref_any);
+}
+
+void MoE::createPrimitive() {
+    const auto weightPrecision = getOriginalInputPrecisionAtPort(2);
+    switch (weightPrecision) {
+    case ov::element::f32:
+        m_executor = std::make_shared<Executor<float>>(this, m_config);
+        break;
+    case ov::element::f16:
+        m_executor = std::make_shared<Executor<ov::float16>>(this, m_config);
+        break;
+    case ov::element::bf16:
+        m_executor = std::make_shared<Executor<ov::bfloat16>>(this, m_config);
+        break;
+    case ov::element::i8:
+        m_executor = std::make_shared<Executor<int8_t>>(this, m_config);
+        break;
+    default:
+        break;
+    }
+    if (!m_executor) {
+        CPU_NODE_THROW("Executor creation fails with weight precision " + weightPrecision.to_string());
+    }
+}
+
+void MoE::execute([[maybe_unused]] const dnnl::stream& strm) {
+    m_executor->execute();
+}
+
+bool MoE::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto node_moe = ov::as_type_ptr<const MoENode>(op);
+        if (!node_moe) {
+            errorMessage = "Only MoENode operation is supported";
+            return false;
+        }
+
+        const auto& config = node_moe->get_config();
+        const auto weightPrecision = op->get_input_element_type(2);
+        const bool supportedPrecision =
+            config.quantized ? weightPrecision == ov::element::i8
+                             : any_of(weightPrecision, ov::element::f32, ov::element::f16, ov::element::bf16);
+        if (!supportedPrecision) {
+            errorMessage = "MoENode weight precision is not supported: " + weightPrecision.to_string();
+            return false;
+        }
+        if (op->get_input_element_type(3) != weightPrecision || op->get_input_element_type(4) != weightPrecision) {
+            errorMessage = "MoENode gate, up and down weights must have the same precision";
+            return false;
+        }
+        for (size_t port = 2; port < op->get_input_size(); port++) {
+            if (!op->get_input_partial_shape(port).is_static()) {
+                errorMessage = "MoENode weight shape is not static";
+                return false;
+            }
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+}  // namespace ov::intel_cpu::node
@@ -365,6 +365,53 @@ void RDFTExecutor::execute(float* inputPtr,
     }
 }
 
+void RDFTExecutor::executeFrames(const float* inputPtr,
+                                 float* outputPtr,
+                                 const std::vector<float>& twiddles,
+                                 size_t numFrames,
+                                 size_t signalSize,
+                                 size_t inputStep,
+                                 size_t outputStep,
+                                 const float* window) {
+    const size_t complexSize = signalSize / 2 + 1;
+    const size_t inputSize = isInverse ? complexSize : signalSize;
+    const size_t outputSize = isInverse ? signalSize : complexSize;
+    const size_t inputFloats = isInverse ? 2 * complexSize : signalSize;
+    const bool useFFT = canUseFFT(signalSize);
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0;
+        size_t end = 0;
+        splitter(numFrames, nthr, ithr, start, end);
+        if (start >= end) {
+            return;
+        }
+        // the frame is copied since the frames may overlap in the input
+        std::vector<float> frame(inputFloats);
+        for (size_t i = start; i < end; i++) {
+            const float* src = inputPtr + i * inputStep;
+            float* dst = outputPtr + i * outputStep;
+            if (window && !isInverse) {
+                std::transform(src, src + signalSize, window, frame.begin(), std::multiplies<>());
+            } else {
+                std::copy_n(src, inputFloats, frame.begin());
+            }
+            dftCommon(frame.data(),
+                      twiddles.data(),
+                      dst,
+                      inputSize,
+                      signalSize,
+                      outputSize,
+                      isInverse ? complex_to_real : real_to_complex,
+                      useFFT,
+                      false);
+            if (window && isInverse) {
+                std::transform(dst, dst + signalSize, window, dst, std::multiplies<>());
+            }
+        }
+    });
+}
+
 static void coordsFromIndex(size_t index,
                             std::vector<size_t>& coords,
                             const std::vector<size_t>& shape,
@@ -652,23 +699,32 @@ void RDFTExecutor::dftOnAxis(enum dft_type type,
     bool parallelizeOuterAxes = totalWorkSize > signalSize;
 
     if (parallelizeOuterAxes) {
-        parallel_for(totalWorkSize, [&](size_t i) {
+        // each thread transforms a range of the lines with its own buffers
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0;
+            size_t end = 0;
+            splitter(totalWorkSize, nthr, ithr, start, end);
+            if (start >= end) {
+                return;
+            }
             std::vector<size_t> coords(iterationRange.size(), 0);
             std::vector<float> gatherScatterBuffer(gatherSize + scatterSize);
             float* gatherBuffer = gatherScatterBuffer.data();
             float* scatterBuffer = &gatherScatterBuffer[gatherSize];
-            coordsFromIndex(i, coords, iterationRange, axis);
-            gather(gatherBuffer, inputPtr, axis, coords, inputSize, inputStrides);
-            dftCommon(gatherBuffer,
-                      twiddlesPtr,
-                      scatterBuffer,
-                      inputSize,
-                      signalSize,
-                      outputSize,
-                      type,
-                      useFFT,
-                      !parallelizeOuterAxes);
-            scatter(outputPtr, scatterBuffer, axis, coords, outputSize, outputStrides);
+            for (size_t i = start; i < end; i++) {
+                coordsFromIndex(i, coords, iterationRange, axis);
+                gather(gatherBuffer, inputPtr, axis, coords, inputSize, inputStrides);
+                dftCommon(gatherBuffer,
+                          twiddlesPtr,
+                          scatterBuffer,
+                          inputSize,
+                          signalSize,
+                          outputSize,
+                          type,
+                          useFFT,
+                          !parallelizeOuterAxes);
+                scatter(outputPtr, scatterBuffer, axis, coords, outputSize, outputStrides);
+            }
         });
     } else {
         std::vector<size_t> coords(iterationRange.size(), 0);
@@ -33,6 +33,18 @@ public:
                  const VectorDims& inputStrides,
                  const VectorDims& outputStrides);
 
+    /* 1D transform of numFrames frames of the same signal size with the twiddles generated once by the caller.
+     * The frames are inputStep / outputStep floats apart, so the input frames may overlap as the STFT frames do.
+     * The optional window multiplies the real samples: before the forward transform and after the inverse one. */
+    void executeFrames(const float* inputPtr,
+                       float* outputPtr,
+                       const std::vector<float>& twiddles,
+                       size_t numFrames,
+                       size_t signalSize,
+                       size_t inputStep,
+                       size_t outputStep,
+                       const float* window = nullptr);
+
     std::vector<std::vector<float>> generateTwiddles(const std::vector<int>& signalSizes,
                                                      const std::vector<size_t>& outputShape,
                                                      const std::vector<int>& axes);
@@ -7,6 +7,7 @@
 #include <oneapi/dnnl/dnnl_types.h>
 
 #include <algorithm>
+#include <cmath>
 #include <common/utils.hpp>
 #include <cstddef>
 #include <cstdint>
@@ -25,6 +26,7 @@
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
 #include "graph_context.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
@@ -1347,6 +1349,321 @@ Node::AttrPtr RNN::initPrimitiveAttr() {
     return attr;
 }
 
+namespace {
+// the hidden units computed together by the fused sequence kernel
+constexpr size_t FUSED_BLOCK = 16;
+constexpr size_t FUSED_MAX_BATCH = 4;
+constexpr size_t FUSED_MIN_HIDDEN = 256;
+
+using FusedAcc = float[FUSED_MAX_BATCH][FUSED_BLOCK];
+
+inline float sigmoid(float x) {
+    return 1.0F / (1.0F + std::exp(-x));
+}
+
+// acc[b][i] += sum_k(w[k][i] * src[b * stride + k])
+template <size_t NB>
+void accumulateBlock(FusedAcc& acc, const float* w, const float* src, size_t K, size_t stride) {
+    for (size_t k = 0; k < K; k++) {
+        const float* w_k = w + k * FUSED_BLOCK;
+        for (size_t b = 0; b < NB; b++) {
+            const float s = src[b * stride + k];
+            for (size_t i = 0; i < FUSED_BLOCK; i++) {
+                acc[b][i] += w_k[i] * s;
+            }
+        }
+    }
+}
+}  // namespace
+
+class RNN::FusedSequenceExecutor {
+public:
+    FusedSequenceExecutor(dnnl::algorithm cell_type, size_t DC, size_t SC, bool reverse, MemoryPtr packed)
+        : m_cell_type(cell_type),
+          m_DC(DC),
+          m_SC(SC),
+          m_G(gatesCount(cell_type)),
+          m_block_size(blockSize(cell_type, DC, SC)),
+          m_reverse(reverse),
+          m_packed(std::move(packed)),
+          m_weights(m_packed->getDataAs<const float>()) {}
+
+    /* The weights of FUSED_BLOCK hidden units are packed together, so each thread reads only its own slice of W and R
+     * at every time step:
+     *   W - [gates, in_data_size, FUSED_BLOCK]
+     *   R - [gates, in_state_size, FUSED_BLOCK]
+     *   B - [bias_gates, FUSED_BLOCK]
+     */
+    static size_t blockSize(dnnl::algorithm cell_type, size_t DC, size_t SC) {
+        const size_t G = gatesCount(cell_type);
+        const size_t Gb = cell_type == dnnl::algorithm::lbr_gru ? G + 1 : G;
+        return (G * (DC + SC) + Gb) * FUSED_BLOCK;
+    }
+
+    void exec(const float* src,
+              const float* src_h,
+              const float* src_c,
+              float* dst,
+              float* dst_h,
+              float* dst_c,
+              size_t batch,
+              size_t steps) {
+        switch (batch) {
+        case 1:
+            run<1>(src, src_h, src_c, dst, dst_h, dst_c, steps);
+            break;
+        case 2:
+            run<2>(src, src_h, src_c, dst, dst_h, dst_c, steps);
+            break;
+        case 3:
+            run<3>(src, src_h, src_c, dst, dst_h, dst_c, steps);
+            break;
+        case 4:
+            run<4>(src, src_h, src_c, dst, dst_h, dst_c, steps);
+            break;
+        default:
+            OPENVINO_THROW("Fused RNN sequence does not support batch ", batch);
+        }
+    }
+
+private:
+    template <size_t NB>
+    void run(const float* src,
+             const float* src_h,
+             const float* src_c,
+             float* dst,
+             float* dst_h,
+             float* dst_c,
+             size_t steps) {
+        const size_t nblocks = div_up(m_SC, FUSED_BLOCK);
+        const int threads = static_cast<int>(std::min(static_cast<size_t>(parallel_get_max_threads()), nblocks));
+        const bool lstm = m_cell_type == dnnl::algorithm::vanilla_lstm;
+        const bool vanilla_gru = m_cell_type == dnnl::algorithm::vanilla_gru;
+        if (lstm) {
+            m_c.assign(src_c, src_c + NB * m_SC);
+        } else if (vanilla_gru) {
+            m_u.resize(NB * m_SC);
+            m_o.resize(NB * m_SC);
+            m_rh.resize(NB * m_SC);
+        }
+
+        const float* h = src_h;
+        for (size_t s = 0; s < steps; s++) {
+            const size_t t = m_reverse ? steps - 1 - s : s;
+            const float* x = src + t * NB * m_DC;
+            float* y = dst + t * NB * m_SC;
+            // the static split keeps the same blocks of the weights on the same thread for the whole sequence
+            parallel_nt_static(threads, [&](const int ithr, const int nthr) {
+                size_t start = 0;
+                size_t end = 0;
+                splitter(nblocks, nthr, ithr, start, end);
+                for (size_t j = start; j < end; j++) {
+                    if (lstm) {
+                        lstmBlock<NB>(j, x, h, y);
+                    } else {
+                        gruBlock<NB>(j, x, h, y);
+                    }
+                }
+            });
+            if (vanilla_gru) {
+                // the candidate depends on the reset hidden state of all the units
+                parallel_nt_static(threads, [&](const int ithr, const int nthr) {
+                    size_t start = 0;
+                    size_t end = 0;
+                    splitter(nblocks, nthr, ithr, start, end);
+                    for (size_t j = start; j < end; j++) {
+                        gruCandidateBlock<NB>(j, h, y);
+                    }
+                });
+            }
+            h = y;
+        }
+
+        if (dst_h) {
+            cpu_memcpy(dst_h, h, NB * m_SC * sizeof(float));
+        }
+        if (dst_c && lstm) {
+            cpu_memcpy(dst_c, m_c.data(), NB * m_SC * sizeof(float));
+        }
+    }
+
+    // acc = B[bias_g] + W[g] * x + R[g] * h, x or h may be skipped
+    template <size_t NB>
+    void projectBlock(FusedAcc& acc, size_t j, size_t g, size_t bias_g, const float* x, const float* h) const {
+        const float* block = m_weights + j * m_block_size;
+        const float* w = block + g * (m_DC + m_SC) * FUSED_BLOCK;
+        const float* bias = block + (m_G * (m_DC + m_SC) + bias_g) * FUSED_BLOCK;
+        for (size_t b = 0; b < NB; b++) {
+            std::copy_n(bias, FUSED_BLOCK, acc[b]);
+        }
+        if (x) {
+            accumulateBlock<NB>(acc, w, x, m_DC, m_DC);
+        }
+        if (h) {
+            accumulateBlock<NB>(acc, w + m_DC * FUSED_BLOCK, h, m_SC, m_SC);
+        }
+    }
+
+    template <size_t NB>
+    void lstmBlock(size_t j, const float* x, const float* h, float* y) {
+        // oneDNN gate order: input, forget, candidate, output
+        FusedAcc acc[4];
+        for (size_t g = 0; g < 4; g++) {
+            projectBlock<NB>(acc[g], j, g, g, x, h);
+        }
+        const size_t h0 = j * FUSED_BLOCK;
+        const size_t n = std::min(FUSED_BLOCK, m_SC - h0);
+        for (size_t b = 0; b < NB; b++) {
+            for (size_t i = 0; i < n; i++) {
+                const size_t idx = b * m_SC + h0 + i;
+                const float c =
+                    sigmoid(acc[1][b][i]) * m_c[idx] + sigmoid(acc[0][b][i]) * std::tanh(acc[2][b][i]);
+                m_c[idx] = c;
+                y[idx] = sigmoid(acc[3][b][i]) * std::tanh(c);
+            }
+        }
+    }
+
+    template <size_t NB>
+    void gruBlock(size_t j, const float* x, const float* h, float* y) {
+        // oneDNN gate order: update, reset, candidate
+        const bool lbr = m_cell_type == dnnl::algorithm::lbr_gru;
+        FusedAcc acc[4];
+        projectBlock<NB>(acc[0], j, 0, 0, x, h);
+        projectBlock<NB>(acc[1], j, 1, 1, x, h);
+        projectBlock<NB>(acc[2], j, 2, 2, x, nullptr);
+        if (lbr) {
+            projectBlock<NB>(acc[3], j, 2, 3, nullptr, h);
+        }
+        const size_t h0 = j * FUSED_BLOCK;
+        const size_t n = std::min(FUSED_BLOCK, m_SC - h0);
+        for (size_t b = 0; b < NB; b++) {
+            for (size_t i = 0; i < n; i++) {
+                const size_t idx = b * m_SC + h0 + i;
+                const float u = sigmoid(acc[0][b][i]);
+                const float r = sigmoid(acc[1][b][i]);
+                if (lbr) {
+                    y[idx] = u * h[idx] + (1.0F - u) * std::tanh(acc[2][b][i] + r * acc[3][b][i]);
+                } else {
+                    m_u[idx] = u;
+                    m_o[idx] = acc[2][b][i];
+                    m_rh[idx] = r * h[idx];
+                }
+            }
+        }
+    }
+
+    template <size_t NB>
+    void gruCandidateBlock(size_t j, const float* h, float* y) {
+        const size_t h0 = j * FUSED_BLOCK;
+        const size_t n = std::min(FUSED_BLOCK, m_SC - h0);
+        FusedAcc acc{};
+        for (size_t b = 0; b < NB; b++) {
+            std::copy_n(m_o.data() + b * m_SC + h0, n, acc[b]);
+        }
+        accumulateBlock<NB>(acc,
+                            m_weights + j * m_block_size + (2 * (m_DC + m_SC) + m_DC) * FUSED_BLOCK,
+                            m_rh.data(),
+                            m_SC,
+                            m_SC);
+        for (size_t b = 0; b < NB; b++) {
+            for (size_t i = 0; i < n; i++) {
+                const size_t idx = b * m_SC + h0 + i;
+                y[idx] = m_u[idx] * h[idx] + (1.0F - m_u[idx]) * std::tanh(acc[b][i]);
+            }
+        }
+    }
+
+    const dnnl::algorithm m_cell_type;
+    const size_t m_DC;
+    const size_t m_SC;
+    const size_t m_G;
+    const size_t m_block_size;
+    const bool m_reverse;
+    const MemoryPtr m_packed;
+    const float* m_weights;
+
+    std::vector<float> m_c;   // LSTM cell state
+    std::vector<float> m_u;   // GRU update gate
+    std::vector<float> m_o;   // GRU candidate input projection
+    std::vector<float> m_rh;  // GRU reset hidden state
+};
+
+bool RNN::useFusedSequence(size_t batch) const {
+    return !is_cell &&
+           any_of(cell_type, dnnl::algorithm::vanilla_lstm, dnnl::algorithm::vanilla_gru, dnnl::algorithm::lbr_gru) &&
+           all_of(memory::data_type::f32, inDataTypes[xIdx], inDataTypes[hIdx], outDataTypes[yIdx]) &&
+           batch <= FUSED_MAX_BATCH && SC >= FUSED_MIN_HIDDEN;
+}
+
+void RNN::prepareFusedSequence() {
+    if (m_fused_executor) {
+        return;
+    }
+    for (const auto& initial_weights : m_initial_weights) {
+        CPU_NODE_ASSERT(initial_weights, "does not have initial weights to pack.");
+    }
+
+    const size_t block_size = FusedSequenceExecutor::blockSize(cell_type, DC, SC);
+    const size_t nblocks = div_up(SC, FUSED_BLOCK);
+    auto create = [&]() {
+        MemoryPtr packed = std::make_shared<Memory>(
+            getEngine(),
+            std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{nblocks * block_size}));
+        auto* dst = packed->getDataAs<float>();
+        // [DC, G, SC], [SC, G, SC], [Gb, SC] -> [SC / FUSED_BLOCK, G, DC + SC, FUSED_BLOCK] + [Gb, FUSED_BLOCK]
+        const auto* w = m_initial_weights[0]->getDataAs<const float>();
+        const auto* r = m_initial_weights[1]->getDataAs<const float>();
+        const auto* b = m_initial_weights[2]->getDataAs<const float>();
+        parallel_for(nblocks, [&](size_t j) {
+            float* block = dst + j * block_size;
+            std::fill_n(block, block_size, 0.0F);
+            const size_t h0 = j * FUSED_BLOCK;
+            const size_t n = std::min(FUSED_BLOCK, SC - h0);
+            for (size_t g = 0; g < G; g++) {
+                float* w_g = block + g * (DC + SC) * FUSED_BLOCK;
+                for (size_t k = 0; k < DC; k++) {
+                    std::copy_n(w + (k * G + g) * SC + h0, n, w_g + k * FUSED_BLOCK);
+                }
+                for (size_t k = 0; k < SC; k++) {
+                    std::copy_n(r + (k * G + g) * SC + h0, n, w_g + (DC + k) * FUSED_BLOCK);
+                }
+            }
+            for (size_t g = 0; g < Gb; g++) {
+                std::copy_n(b + g * SC + h0, n, block + (G * (DC + SC) + g) * FUSED_BLOCK);
+            }
+        });
+        return packed;
+    };
+
+    MemoryPtr packed;
+    if (auto weight_cache = context->getWeightsCache()) {
+        packed = *weight_cache->findOrCreate(getName() + "_fused", create);
+    } else {
+        packed = create();
+    }
+    m_fused_executor = std::make_shared<FusedSequenceExecutor>(cell_type,
+                                                               DC,
+                                                               SC,
+                                                               direction == rnn_direction::unidirectional_right2left,
+                                                               packed);
+}
+
+void RNN::executeFusedSequence() {
+    const auto& dims = getSrcMemoryAtPort(xIdx)->getShape().getStaticDims();
+    const bool cell_state = haveCellState(cell_type);
+    // the states outputs may be absent, the first output is a sequence data
+    const size_t n_ports_with_init_states = outputShapes.size() - 1;
+    m_fused_executor->exec(getSrcDataAtPortAs<const float>(xIdx),
+                           getSrcDataAtPortAs<const float>(hIdx),
+                           cell_state ? getSrcDataAtPortAs<const float>(cIdx) : nullptr,
+                           getDstDataAtPortAs<float>(yIdx),
+                           n_ports_with_init_states > 0 ? getDstDataAtPortAs<float>(hoIdx) : nullptr,
+                           cell_state && n_ports_with_init_states > 1 ? getDstDataAtPortAs<float>(coIdx) : nullptr,
+                           dims[0],
+                           dims[1]);
+}
+
 void RNN::prepareParams() {
     for (size_t i = 0; i < wIdx; i++) {
         auto memPtr = getSrcMemoryAtPort(i);
@@ -1360,6 +1677,13 @@ void RNN::prepareParams() {
     auto dataMemPtr = getSrcMemoryAtPort(0);
     const size_t B = dataMemPtr->getShape().getStaticDims()[0];
     const size_t SL = is_cell ? 1LU : dataMemPtr->getShape().getStaticDims()[1];
+
+    m_use_fused = useFusedSequence(B);
+    if (m_use_fused) {
+        prepareFusedSequence();
+        return;
+    }
+
     const Shape shapeS_4D{L, D, B, SC};
 
     inDataDescs[0] =
@@ -1444,6 +1768,11 @@ std::shared_ptr<MemoryDesc> RNN::getDstMemDesc([[maybe_unused]] const dnnl::prim
 }
 
 void RNN::execute(const dnnl::stream& strm) {
+    if (m_use_fused) {
+        executeFusedSequence();
+        return;
+    }
+
     CPU_NODE_ASSERT(execPtr, "does not have initialized primitive to execute.");
 
     const auto src_data_mem = getSrcMemoryAtPort(0);
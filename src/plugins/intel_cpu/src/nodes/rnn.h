@@ -72,6 +72,10 @@ private:
 
     void copyWeightsData();
 
+    bool useFusedSequence(size_t batch) const;
+    void prepareFusedSequence();
+    void executeFusedSequence();
+
     void prepareMemory(const DnnlMemoryDescPtr& new_desc, size_t idx) override;
     class RnnDnnlExecutor : public DnnlExecutorLegacy {
     public:
@@ -93,6 +97,11 @@ private:
     using executorPtr = std::shared_ptr<RnnDnnlExecutor>;
     executorPtr execPtr = nullptr;
 
+    /** f32 LSTM / GRU sequence for small batches, the hidden units are split between the threads */
+    class FusedSequenceExecutor;
+    std::shared_ptr<FusedSequenceExecutor> m_fused_executor = nullptr;
+    bool m_use_fused = false;
+
     /** Specify mode Cell or Seq. true - Cell, false - Seq */
     bool is_cell = false;
 
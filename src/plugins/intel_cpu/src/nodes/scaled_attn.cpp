@@ -11,6 +11,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
@@ -63,6 +64,7 @@
 
 #include "kernels/scaled_attn/attn_memcpy.hpp"
 #include "kernels/scaled_attn/attn_quant.hpp"
+#include "kernels/scaled_attn/cache_rotation.hpp"
 #include "kernels/scaled_attn/mha_single_token.hpp"
 #include "kernels/scaled_attn/softmax.hpp"
 #include "kernels/x64/brgemm_kernel.hpp"
@@ -284,9 +286,36 @@ struct MHAKernel<ScaledDotProductAttention::KT_ONEDNN, T> {
     std::shared_ptr<BrgemmKernel> qk_gemm_ptr = nullptr;
     std::shared_ptr<BrgemmKernel> wv_gemm_ptr = nullptr;
 
+    // Tiled prefill (flash attention) for the contexts longer than one block of keys: the scores are computed for
+    // flash_kv_block keys at a time and merged by the online softmax, so a thread keeps a [m_block, flash_kv_block]
+    // score tile and a [m_block, SV] accumulator whatever the context length is.
+    static constexpr size_t flash_kv_block = 512;
+    std::shared_ptr<BrgemmKernel> flash_qk_gemm[2];  // the full and the tail blocks of keys
+    std::shared_ptr<BrgemmKernel> flash_wv_gemm[2];
+    PlainTensor flash_acc;   // f32[nthr, 2, m_block, SV] the accumulated output and the output of the block
+    PlainTensor flash_stat;  // f32[nthr, 2, m_block] the running max and sum of the rows
+    PlainTensor flash_k;     // T[nthr, flash_kv_block, S] the block of keys gathered by the beam table / dequantized
+    PlainTensor flash_v;     // T[nthr, flash_kv_block, SV]
+    PlainTensor flash_tmp;   // f32[nthr, max(S, SV)]
+
     MHAKernel() = delete;
     explicit MHAKernel(GraphContext::CPtr ctx) : context(std::move(ctx)) {}
 
+    static std::shared_ptr<BrgemmKernel> create_gemm(const brgemmKey& key) {
+        return std::make_shared<BrgemmKernel>(key.M,
+                                              key.N,
+                                              key.K,
+                                              key.lda,
+                                              key.ldb,
+                                              key.ldc,
+                                              key.b_transposed,
+                                              key.in_type);
+    }
+
+    [[nodiscard]] static bool use_tiled(size_t kv_len) {
+        return kv_len > flash_kv_block;
+    }
+
     dnnl::memory::dims make_dnnl_dims(const std::vector<size_t>& dims) {
         dnnl::memory::dims dnnl_dims(dims.size());
         for (size_t i = 0; i < dims.size(); i++) {
@@ -311,19 +340,8 @@ struct MHAKernel<ScaledDotProductAttention::KT_ONEDNN, T> {
         auto Hk = present_key.size(1);
         brgemmKey qk_key = {q_len, kv_len, head_size, query.stride(2), present_key.stride(2), kv_len, true, in_type};
 
-        auto builder = [](const brgemmKey& key) -> std::shared_ptr<BrgemmKernel> {
-            return std::make_shared<BrgemmKernel>(key.M,
-                                                  key.N,
-                                                  key.K,
-                                                  key.lda,
-                                                  key.ldb,
-                                                  key.ldc,
-                                                  key.b_transposed,
-                                                  key.in_type);
-        };
-
         auto cache = this->context->getParamsCache();
-        auto qk_result = cache->getOrCreate(qk_key, builder);
+        auto qk_result = cache->getOrCreate(qk_key, create_gemm);
         OPENVINO_ASSERT(qk_result.first, "ScaledDotProductAttention 1st token qk gemm creation fails");
 
         qk_gemm_ptr = qk_result.first;
@@ -346,7 +364,7 @@ struct MHAKernel<ScaledDotProductAttention::KT_ONEDNN, T> {
                             false,
                             in_type};
 
-        auto wv_result = cache->getOrCreate(wv_key, builder);
+        auto wv_result = cache->getOrCreate(wv_key, create_gemm);
         OPENVINO_ASSERT(wv_result.first, "ScaledDotProductAttention 1st token wv gemm creation fails");
 
         wv_gemm_ptr = wv_result.first;
@@ -506,6 +524,289 @@ struct MHAKernel<ScaledDotProductAttention::KT_ONEDNN, T> {
         });
     }
 
+    // gather == true: the keys and values are copied block by block to the thread buffers, since they are either
+    // reordered by the beam table or quantized, otherwise all the blocks are packed in advance
+    void prepare_tiled(const PlainTensor& query,
+                       const PlainTensor& present_key,
+                       const PlainTensor& present_value,
+                       bool gather) {
+        auto in_type = precision_of<T>::value;
+        const auto B = query.size(0);
+        const auto q_len = query.size(2);
+        const auto head_size = query.size(3);
+        const auto head_size_v = present_value.size(3);
+        const auto kv_len = present_key.size(2);
+        const auto Hk = present_key.size(1);
+        const size_t ldk = gather ? head_size : present_key.stride(2);
+        const size_t ldv = gather ? head_size_v : present_value.stride(2);
+        // the weights are stored in place of the f32 scores
+        const size_t ldw = flash_kv_block * (in_type == ov::element::f32 ? 1 : 2);
+
+        auto cache = this->context->getParamsCache();
+        const size_t block_sizes[2] = {flash_kv_block, kv_len % flash_kv_block};
+        for (size_t i = 0; i < 2; i++) {
+            flash_qk_gemm[i] = nullptr;
+            flash_wv_gemm[i] = nullptr;
+            const auto n = block_sizes[i];
+            if (n == 0) {
+                continue;
+            }
+            brgemmKey qk_key = {q_len, n, head_size, query.stride(2), ldk, flash_kv_block, true, in_type};
+            brgemmKey wv_key = {q_len, head_size_v, n, ldw, ldv, head_size_v, false, in_type};
+            flash_qk_gemm[i] = cache->getOrCreate(qk_key, create_gemm).first;
+            flash_wv_gemm[i] = cache->getOrCreate(wv_key, create_gemm).first;
+            OPENVINO_ASSERT(flash_qk_gemm[i] && flash_wv_gemm[i],
+                            "ScaledDotProductAttention tiled prefill gemm creation fails");
+        }
+
+        m_threads_num = static_cast<size_t>(parallel_get_max_threads());
+        wsp_size_per_thread = BrgemmKernel::get_wsp_size();
+        wsp.resize(m_threads_num * wsp_size_per_thread);
+
+        size_t qk_scratch_a_size = 0;
+        size_t wv_scratch_a_size = 0;
+        for (size_t i = 0; i < 2; i++) {
+            if (flash_qk_gemm[i]) {
+                qk_scratch_a_size = std::max(qk_scratch_a_size, flash_qk_gemm[i]->get_scratch_a_size());
+                wv_scratch_a_size = std::max(wv_scratch_a_size, flash_wv_gemm[i]->get_scratch_a_size());
+            }
+        }
+        // the tail block never needs more packed memory than the full one
+        size_t data_size = sizeof(T);
+        const size_t k_packed_size = flash_qk_gemm[0]->get_scratch_b_size() / data_size;
+        const size_t v_packed_size = flash_wv_gemm[0]->get_scratch_b_size() / data_size;
+        qk_scratch_a.resize<T>({m_threads_num, qk_scratch_a_size / data_size});
+        wv_scratch_a.resize<T>({m_threads_num, wv_scratch_a_size / data_size});
+        if (gather) {
+            qk_scratch_b.resize<T>({m_threads_num, k_packed_size});
+            wv_scratch_b.resize<T>({m_threads_num, v_packed_size});
+            flash_k.resize<T>({m_threads_num, flash_kv_block, head_size});
+            flash_v.resize<T>({m_threads_num, flash_kv_block, head_size_v});
+            flash_tmp.resize<float>({m_threads_num, std::max(head_size, head_size_v)});
+        } else {
+            const auto n_blocks = div_up(kv_len, flash_kv_block);
+            qk_scratch_b.resize<T>({B, Hk, n_blocks, k_packed_size});
+            wv_scratch_b.resize<T>({B, Hk, n_blocks, v_packed_size});
+        }
+
+        const size_t m_block_size = BrgemmKernel::get_mblk_size();
+        weight_score.resize<float>({m_threads_num, 1, m_block_size, flash_kv_block});
+        flash_acc.resize<float>({m_threads_num, 2, m_block_size, head_size_v});
+        flash_stat.resize<float>({m_threads_num, 2, m_block_size});
+    }
+
+    // present_key/present_value may be u8 with the scales and zero points in k_scale_zp/v_scale_zp,
+    // and the rows of the batch may be reordered by the beam table
+    void execute_tiled(PlainTensor& query,
+                       PlainTensor& present_key,
+                       PlainTensor& present_value,
+                       const PlainTensor& attention_mask,
+                       PlainTensor& output_emb,
+                       bool has_out_transpose,
+                       bool auto_causal,
+                       float d_scale,
+                       const PlainTensor& beams = {},
+                       const PlainTensor& k_scale_zp = {},
+                       const PlainTensor& v_scale_zp = {},
+                       size_t key_group_size = 0,
+                       size_t value_group_size = 0,
+                       bool quant_key_by_channel = false) {
+        const auto B = query.size(0);
+        const auto H = query.size(1);
+        const auto q_len = query.size(2);
+        const auto head_size = query.size(3);
+        const auto head_size_v = present_value.size(3);
+        const auto Hk = present_key.size(1);
+        const auto kv_len = present_key.size(2);
+        const size_t h_each_group_len = H / Hk;
+        const size_t m_block_size = BrgemmKernel::get_mblk_size();
+        const auto m_blocks = div_up(q_len, m_block_size);
+        const auto n_blocks = div_up(kv_len, flash_kv_block);
+        const auto precision = precision_of<T>::value;
+        const bool is_xf16 = any_of(precision, ov::element::bf16, ov::element::f16);
+        const bool is_quantized = present_key.get_precision() == ov::element::u8;
+        const bool gather = is_quantized || static_cast<bool>(beams);
+        if (d_scale == 0.0F) {
+            d_scale = 1.0F / static_cast<float>(sqrt(head_size));
+        }
+        prepare_tiled(query, present_key, present_value, gather);
+
+        if (!gather) {
+            parallel_for3d(B, Hk, n_blocks, [&](size_t b, size_t h, size_t n_blk) {
+                const auto n_start = n_blk * flash_kv_block;
+                const auto idx = n_start + flash_kv_block > kv_len ? 1 : 0;
+                flash_qk_gemm[idx]->copy_buffer_b(&present_key.at<T>({b, h, n_start, 0}),
+                                                  &qk_scratch_b.at<T>({b, h, n_blk, 0}));
+                if (is_xf16) {
+                    flash_wv_gemm[idx]->copy_buffer_b(&present_value.at<T>({b, h, n_start, 0}),
+                                                      &wv_scratch_b.at<T>({b, h, n_blk, 0}));
+                }
+            });
+        }
+
+        // copies the rows [n_start, n_start + n_cnt) of the keys and values to the thread buffers
+        auto gather_kv = [&](size_t ithr, size_t b, size_t h, size_t n_start, size_t n_cnt) {
+            auto* tmp = flash_tmp.ptr<float>(ithr);
+            for (size_t n = n_start; n < n_start + n_cnt; n++) {
+                const size_t b_kv = beams ? beams.ptr<int32_t>(b)[n] : b;
+                auto* k_dst = flash_k.ptr<T>(ithr, n - n_start);
+                auto* v_dst = flash_v.ptr<T>(ithr, n - n_start);
+                if (!is_quantized) {
+                    std::memcpy(k_dst, present_key.ptr<T>(b_kv, h, n), head_size * sizeof(T));
+                    std::memcpy(v_dst, present_value.ptr<T>(b_kv, h, n), head_size_v * sizeof(T));
+                    continue;
+                }
+                auto* k_src = present_key.ptr<uint8_t>(b_kv, h, n);
+                if (quant_key_by_channel) {
+                    auto* scale = k_scale_zp.ptr<float>(n / key_group_size * 2, b_kv, h);
+                    auto* zp = k_scale_zp.ptr<float>(n / key_group_size * 2 + 1, b_kv, h);
+                    attn_dequant_by_channel_u8(k_src, tmp, 1, head_size, head_size, head_size, scale, zp);
+                } else {
+                    auto* p = k_scale_zp.ptr<float>(n, b_kv, h);
+                    for (size_t g = 0; g < head_size / key_group_size; g++) {
+                        const auto offset = g * key_group_size;
+                        attn_dequant_u8(k_src + offset, tmp + offset, key_group_size, p[2 * g], p[2 * g + 1]);
+                    }
+                }
+                attn_memcpy2d_kernel(tmp, k_dst, ov::element::f32, precision, 0, 0, head_size, 1);
+
+                auto* v_src = present_value.ptr<uint8_t>(b_kv, h, n);
+                auto* p = v_scale_zp.ptr<float>(n, b_kv, h);
+                for (size_t g = 0; g < head_size_v / value_group_size; g++) {
+                    const auto offset = g * value_group_size;
+                    attn_dequant_u8(v_src + offset, tmp + offset, value_group_size, p[2 * g], p[2 * g + 1]);
+                }
+                attn_memcpy2d_kernel(tmp, v_dst, ov::element::f32, precision, 0, 0, head_size_v, 1);
+            }
+        };
+
+        auto bhb_loop = [&](size_t ithr, size_t b, size_t h, size_t m_blk) {
+            const auto m_start = m_blk * m_block_size;
+            const auto m_end = std::min(m_start + m_block_size, q_len);
+            const auto m_cnt = m_end - m_start;
+            const bool is_m_tail = m_cnt < m_block_size;
+            const auto hk = h / h_each_group_len;
+            T* q_ptr = &query.at<T>({b, h, m_start, 0});
+            auto* score = weight_score.ptr<float>(ithr, 0, 0, 0);
+            auto* acc = flash_acc.ptr<float>(ithr, 0, 0, 0);
+            auto* wv_out = flash_acc.ptr<float>(ithr, 1, 0, 0);
+            auto* row_max = flash_stat.ptr<float>(ithr, 0, 0);
+            auto* row_sum = flash_stat.ptr<float>(ithr, 1, 0);
+            std::fill_n(row_max, m_cnt, std::numeric_limits<float>::lowest());
+            std::fill_n(row_sum, m_cnt, 0.0F);
+            std::fill_n(acc, m_cnt * head_size_v, 0.0F);
+
+            uint8_t* attn_mask_ptr = nullptr;
+            size_t attn_mask_stride = 0;
+            if (attention_mask) {
+                attn_mask_ptr = reinterpret_cast<uint8_t*>(&attention_mask.at<T>({b, h, 0, 0}, true));
+                if (attention_mask.size(2) > 1) {
+                    attn_mask_stride = attention_mask.stride_bytes(2);
+                }
+            }
+            uint8_t* cmask_ptr = nullptr;
+            size_t cmask_stride = 0;
+            if (causal_mask) {
+                cmask_ptr = &causal_mask.at<uint8_t>({b, h, 0, 0}, true);
+                if (causal_mask.size(2) > 1) {
+                    cmask_stride = causal_mask.stride(2);
+                }
+            }
+            const auto attn_mask_prec = attention_mask ? attention_mask.get_precision() : precision;
+            const auto attn_mask_size = attn_mask_prec.size();
+
+            // the blocks of keys past the causal boundary of the last row are skipped altogether
+            const size_t n_end = auto_causal ? kv_len - q_len + m_end : kv_len;
+            for (size_t n_start = 0; n_start < n_end; n_start += flash_kv_block) {
+                const auto n_blk = n_start / flash_kv_block;
+                const auto n_cnt = std::min(flash_kv_block, kv_len - n_start);
+                const auto idx = n_cnt < flash_kv_block ? 1 : 0;
+                T* k_ptr = nullptr;
+                T* v_ptr = nullptr;
+                if (gather) {
+                    gather_kv(ithr, b, hk, n_start, n_cnt);
+                    k_ptr = qk_scratch_b.ptr<T>(ithr);
+                    flash_qk_gemm[idx]->copy_buffer_b(flash_k.ptr<T>(ithr), k_ptr);
+                    v_ptr = flash_v.ptr<T>(ithr);
+                    if (is_xf16) {
+                        flash_wv_gemm[idx]->copy_buffer_b(v_ptr, wv_scratch_b.ptr<T>(ithr));
+                        v_ptr = wv_scratch_b.ptr<T>(ithr);
+                    }
+                } else {
+                    k_ptr = &qk_scratch_b.at<T>({b, hk, n_blk, 0});
+                    v_ptr = is_xf16 ? &wv_scratch_b.at<T>({b, hk, n_blk, 0})
+                                    : &present_value.at<T>({b, hk, n_start, 0});
+                }
+
+                flash_qk_gemm[idx]->executeGemm(is_m_tail,
+                                                q_ptr,
+                                                k_ptr,
+                                                score,
+                                                wsp.data() + ithr * wsp_size_per_thread,
+                                                qk_scratch_a ? &qk_scratch_a.at<T>({ithr, 0}) : nullptr);
+                for (size_t m = m_start; m < m_end; m++) {
+                    auto* s = score + (m - m_start) * flash_kv_block;
+                    // the keys of the block visible to the row
+                    size_t n_valid = n_cnt;
+                    if (auto_causal) {
+                        const size_t ncausal = kv_len - q_len + m + 1;
+                        n_valid = ncausal > n_start ? std::min(n_cnt, ncausal - n_start) : 0;
+                    }
+                    if (n_valid == 0) {
+                        std::memset(s, 0, n_cnt * sizeof(T));
+                        continue;
+                    }
+                    const auto rescale =
+                        attn_softmax_online(s,
+                                            s,
+                                            d_scale,
+                                            attn_mask_ptr ? attn_mask_ptr + m * attn_mask_stride +
+                                                                n_start * attn_mask_size
+                                                          : nullptr,
+                                            cmask_ptr ? cmask_ptr + m * cmask_stride + n_start : nullptr,
+                                            select_nfltmax_at_0,
+                                            n_valid,
+                                            n_cnt,
+                                            row_max[m - m_start],
+                                            row_sum[m - m_start],
+                                            attn_mask_prec,
+                                            precision);
+                    if (rescale != 1.0F) {
+                        auto* acc_row = acc + (m - m_start) * head_size_v;
+                        for (size_t i = 0; i < head_size_v; i++) {
+                            acc_row[i] *= rescale;
+                        }
+                    }
+                }
+                flash_wv_gemm[idx]->executeGemm(
+                    is_m_tail,
+                    reinterpret_cast<T*>(score),
+                    v_ptr,
+                    wv_out,
+                    wsp.data() + ithr * wsp_size_per_thread,
+                    wv_scratch_a ? &wv_scratch_a.at<T>({ithr, 0}) : nullptr);
+                for (size_t i = 0; i < m_cnt * head_size_v; i++) {
+                    acc[i] += wv_out[i];
+                }
+            }
+
+            for (size_t m = m_start; m < m_end; m++) {
+                auto* acc_row = acc + (m - m_start) * head_size_v;
+                const float scale = 1.0F / row_sum[m - m_start];
+                for (size_t i = 0; i < head_size_v; i++) {
+                    acc_row[i] *= scale;
+                }
+                auto* out = has_out_transpose ? &output_emb.at<T>({b, m, h * head_size_v})
+                                              : &output_emb.at<T>({b, h, m, 0});
+                attn_memcpy2d_kernel(acc_row, out, ov::element::f32, precision, 0, 0, head_size_v, 1);
+            }
+        };
+
+        parallel_nt_static(m_threads_num, [&](const int ithr, const int nthr) {
+            for_3d(ithr, nthr, B, H, m_blocks, bhb_loop);
+        });
+    }
+
     PlainTensor causal_mask;
     bool select_nfltmax_at_0 = false;  // set attn_score to -FLT_MAX when causal_mask[...] equal to this
     void set_causal_mask(const PlainTensor& mask, bool _select_nfltmax_at_0) {
@@ -535,6 +836,18 @@ struct MHAKernel<ScaledDotProductAttention::KT_ONEDNN, T> {
             d_scale = 1.0F / static_cast<float>(sqrt(head_size));
         }
 
+        if (use_tiled(present_key.size(2)) && !alibi_mask) {
+            execute_tiled(query,
+                          present_key,
+                          present_value,
+                          attention_mask,
+                          output_emb,
+                          has_out_transpose,
+                          auto_causal,
+                          d_scale);
+            return;
+        }
+
         prepare_brgemm_prim(strm, query, present_key, present_value, has_out_transpose);
         execute_brgemm(query,
                        present_key,
@@ -1087,7 +1400,31 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
 
         // second token, or first token with pastkv fusing
         bool use_one_token = L1 == 1 || (fuse_concat && L0 > 0);
-        if (!use_one_token) {
+        // a long prompt over the past kv cache: the tiled kernel reads the cache block by block
+        bool use_tiled_with_past = false;
+        if constexpr (KType == KT_ONEDNN) {
+            use_tiled_with_past = use_one_token && L1 >= BrgemmKernel::get_mblk_size() &&
+                                  kernel.use_tiled(L0 + L1) &&
+                                  any_of(present_key.get_precision(), ov::element::u8, precision_of<T>::value);
+        }
+        if (use_tiled_with_past) {
+            if constexpr (KType == KT_ONEDNN) {
+                kernel.execute_tiled(q_input,
+                                     present_key,
+                                     present_value,
+                                     use_attn_mask ? attn_mask : PlainTensor(),
+                                     output_emb,
+                                     has_out_transpose,
+                                     auto_causal,
+                                     scale_input,
+                                     beam_table,
+                                     k_scale_zp,
+                                     v_scale_zp,
+                                     kernel_single_token.m_key_group_size,
+                                     kernel_single_token.m_value_group_size,
+                                     kernel_single_token.m_quant_key_by_channel);
+            }
+        } else if (!use_one_token) {
             // multi-token version
             kernel(strm,
                    q_input,
@@ -1155,6 +1492,9 @@ ScaledDotProductAttention::ScaledDotProductAttention(const std::shared_ptr<ov::N
     } else if (const auto node = ov::as_type_ptr<const SDPAWithTransposeReshape>(op)) {
         m_config.config = node->get_config();
     }
+    m_sink_size = cpuConfig.kvCacheSinkSize;
+    m_window_size = cpuConfig.kvCacheWindowSize;
+    m_rope_theta = cpuConfig.kvCacheRopeTheta;
 }
 
 void ScaledDotProductAttention::initSupportedPrimitiveDescriptors() {
@@ -1257,6 +1597,13 @@ void ScaledDotProductAttention::createPrimitive() {
     OPENVINO_ASSERT(valueS % m_value_quant_param.groupSize == 0,
                     "ScaledDotProductAttention AttentionExecutor creation fails value state " + std::to_string(keyS) +
                         " cannot be divided by group size " + std::to_string(m_key_quant_param.groupSize));
+    if (m_config.config.fuse_concat && m_window_size > 0) {
+        CPU_NODE_ASSERT(getKVCachePrecision() != ov::element::u8 || !m_key_quant_param.isByChannel,
+                        "does not support the bounded KV-cache with the key cache quantized by channel");
+        CPU_NODE_ASSERT(m_rope_theta == 0.0F || m_sink_size == 0 || keyS % 2 == 0,
+                        "cannot rotate the attention sink keys with the odd head size ",
+                        keyS);
+    }
     ScaledDotProductAttentionKey key = {rtPrecision};
 
     auto builder = [&]([[maybe_unused]] const ScaledDotProductAttentionKey& key) -> std::shared_ptr<Executor> {
@@ -1356,12 +1703,18 @@ void ScaledDotProductAttention::execute(const dnnl::stream& strm) {
         beam_input = m_k_state->hidden_state_mem();
         k_scale_zp = m_k_state->get_scale_zp();
         v_scale_zp = m_v_state->get_scale_zp();
+        if (m_window_size > 0 && orginSDPInputNumber > 3) {
+            inputs[3] = remapAttnMask(inputs[3]);
+        }
     } else {
         presentk_input = inputs[1];
         presentv_input = inputs[2];
     }
     m_executor
         ->execute(strm, m_config, inputs, output, presentk_input, presentv_input, beam_input, k_scale_zp, v_scale_zp);
+    if (m_config.config.fuse_concat && m_window_size > 0) {
+        evictPastkv();
+    }
 }
 
 bool ScaledDotProductAttention::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
@@ -1439,6 +1792,22 @@ std::vector<T> permute_axes(const std::vector<T>& shape, const std::vector<size_
     return results;
 }
 
+// Evicts the oldest window tokens from a buffer of `length` rows (one per token) of a bounded KV-cache, the first
+// `sink` rows are kept. A single extra token replaces the oldest one in the ring of the window rows, several extra
+// tokens are evicted by compacting the window rows in their logical order.
+static void evict_rows(uint8_t* base, size_t row, size_t sink, size_t window, size_t ring_offset, size_t length) {
+    const size_t capacity = sink + window;
+    if (length == capacity + 1) {
+        std::memcpy(base + (sink + ring_offset) * row, base + capacity * row, row);
+        return;
+    }
+    auto* window_base = base + sink * row;
+    if (ring_offset > 0) {
+        std::rotate(window_base, window_base + ring_offset * row, window_base + window * row);
+    }
+    std::memmove(window_base, window_base + (length - capacity) * row, window * row);
+}
+
 void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
                                                      const MemoryPtr& mem_cur_v,
                                                      const MemoryPtr& mem_beam_idx) {
@@ -1491,6 +1860,22 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
                         B_state);
     }
 
+    // the original sink keys are kept per cache row, gather them for the rows of the new batch
+    auto& window_k = m_k_state->window_state();
+    if (window_k.sink_keys) {
+        PlainTensor sink_keys;
+        sink_keys.resize<float>({B, H, m_sink_size, S});
+        parallel_for2d(B, m_sink_size, [&](size_t b, size_t m) {
+            auto b_kv = static_cast<size_t>(old_beam_table_k.at<int32_t>({static_cast<size_t>(table[b]), m}));
+            for (size_t h = 0; h < H; h++) {
+                std::memcpy(sink_keys.ptr<float>(b, h, m),
+                            window_k.sink_keys.ptr<float>(b_kv, h, m),
+                            S * sizeof(float));
+            }
+        });
+        window_k.sink_keys = sink_keys;
+    }
+
     // 2. resize pastkv
     ov::element::Type kvcache_precision = m_k_state->internal_desc()->getPrecision();
     {
@@ -2096,6 +2481,253 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
     }
 }
 
+// Keeps the first m_sink_size tokens and the last m_window_size tokens in the state once the current tokens are
+// appended and attended to, so the cache never outgrows its high-water mark. The ring of the window tokens is not
+// ordered, which doesn't matter for the single-token steps: the new token attends to all the cached ones and
+// remapAttnMask moves the mask columns to the slots.
+void ScaledDotProductAttention::evictPastkv() {
+    std::vector<size_t> order = {0, 1, 2, 3};
+    if (!m_config.config.permute_axes.empty()) {
+        order = m_config.config.permute_axes;
+    }
+    const std::vector<size_t> real_order = getKVCacheOrder();
+    auto internal_mem_k = m_k_state->internal_state_mem();
+    auto internal_mem_v = m_v_state->internal_state_mem();
+    auto&& k_dims = internal_mem_k->getStaticDims();
+    auto&& v_dims = internal_mem_v->getStaticDims();
+    const size_t length = k_dims.at(order[2]);
+    const size_t capacity = m_sink_size + m_window_size;
+    if (length <= capacity) {
+        return;
+    }
+    const size_t B = k_dims.at(order[0]);
+    const size_t H = k_dims.at(order[1]);
+    const size_t S = k_dims.at(order[3]);
+    const size_t SV = v_dims.at(order[3]);
+    auto& window_k = m_k_state->window_state();
+    auto& window_v = m_v_state->window_state();
+    const size_t ring_offset = window_k.ring_offset;
+    auto reverse = [&order](const std::vector<size_t>& cur) {
+        std::vector<size_t> result(cur.size());
+        for (size_t i = 0; i < cur.size(); i++) {
+            result[order[i]] = cur[i];
+        }
+        return result;
+    };
+
+    // the tokens are the outermost dimension of the kv cache and the scales / zero points
+    ov::element::Type kvcache_precision = m_k_state->internal_desc()->getPrecision();
+    for (const auto& mem : {internal_mem_k, internal_mem_v}) {
+        const auto token_stride = mem->getDescWithType<BlockedMemoryDesc>()->getStrides()[0];
+        evict_rows(mem->getDataAs<uint8_t>(),
+                   token_stride * kvcache_precision.size(),
+                   m_sink_size,
+                   m_window_size,
+                   ring_offset,
+                   length);
+    }
+    if (kvcache_precision == ov::element::u8) {
+        for (auto* scale_zp : {&m_k_state->get_scale_zp(), &m_v_state->get_scale_zp()}) {
+            evict_rows(reinterpret_cast<uint8_t*>(scale_zp->ptr<float>()),
+                       scale_zp->m_strides[0] * sizeof(float),
+                       m_sink_size,
+                       m_window_size,
+                       ring_offset,
+                       length);
+        }
+    }
+    PlainTensor beam_table_k;
+    PlainTensor beam_table_v;
+    beam_table_k.reset(m_k_state->hidden_state_mem());
+    beam_table_v.reset(m_v_state->hidden_state_mem());
+    for (size_t b = 0; b < B; b++) {
+        for (auto* beam_table : {&beam_table_k, &beam_table_v}) {
+            evict_rows(reinterpret_cast<uint8_t*>(beam_table->ptr<int32_t>(b)),
+                       sizeof(int32_t),
+                       m_sink_size,
+                       m_window_size,
+                       ring_offset,
+                       length);
+        }
+    }
+
+    for (auto* window : {&window_k, &window_v}) {
+        window->sink = m_sink_size;
+        window->window = m_window_size;
+        window->ring_offset = length == capacity + 1 ? (ring_offset + 1) % m_window_size : 0;
+        window->evicted += length - capacity;
+    }
+
+    auto redefine_desc = [&](const MemoryPtr& mem, size_t new_S) {
+        std::vector<size_t> new_shape = reverse({B, H, capacity, new_S});
+        auto real_shape = permute_axes(new_shape, real_order);
+        auto strides = mem->getDescWithType<BlockedMemoryDesc>()->getStrides();
+        mem->redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(kvcache_precision,
+                                                                  Shape(new_shape),
+                                                                  real_shape,
+                                                                  real_order,
+                                                                  0,
+                                                                  VectorDims{},
+                                                                  strides));
+    };
+    redefine_desc(internal_mem_k, S);
+    redefine_desc(internal_mem_v, SV);
+    for (const auto& hidden_state : {m_k_state->hidden_state_mem(), m_v_state->hidden_state_mem()}) {
+        std::vector<size_t> new_shape{B, capacity};
+        hidden_state->redefineDesc(
+            std::make_shared<CpuBlockedMemoryDesc>(ov::element::i32,
+                                                   Shape(new_shape),
+                                                   new_shape,
+                                                   VectorDims{0, 1},
+                                                   0,
+                                                   VectorDims{},
+                                                   hidden_state->getDescWithType<BlockedMemoryDesc>()->getStrides()));
+    }
+
+    if (m_sink_size > 0 && m_rope_theta > 0.0F) {
+        rotateSinkKeys();
+    }
+}
+
+// The window keys keep the positions they were produced with, so the sink keys are rotated to the positions right
+// before the oldest window token: by the number of evicted tokens from their original positions.
+void ScaledDotProductAttention::rotateSinkKeys() {
+    std::vector<size_t> order = {0, 1, 2, 3};
+    if (!m_config.config.permute_axes.empty()) {
+        order = m_config.config.permute_axes;
+    }
+    PlainTensor past_k;
+    PlainTensor beam_table_k;
+    PlainTensor beam_table_v;
+    past_k.reset(m_k_state->internal_state_mem());
+    past_k = past_k.permute(order);
+    beam_table_k.reset(m_k_state->hidden_state_mem());
+    beam_table_v.reset(m_v_state->hidden_state_mem());
+    const auto B = past_k.size(0);
+    const auto H = past_k.size(1);
+    const auto S = past_k.size(3);
+    auto& window = m_k_state->window_state();
+    auto& scale_zp = m_k_state->get_scale_zp();
+    const bool quantized = past_k.get_precision() == ov::element::u8;
+    const size_t group_size = m_key_quant_param.groupSize;
+
+    // the original sink keys are captured at the first eviction, every cache row owns its sink tokens since then
+    if (!window.sink_keys) {
+        window.sink_keys.resize<float>({B, H, m_sink_size, S});
+        parallel_for3d(B, H, m_sink_size, [&](size_t b, size_t h, size_t m) {
+            auto b_kv = static_cast<size_t>(beam_table_k.at<int32_t>({b, m}));
+            auto* dst = window.sink_keys.ptr<float>(b, h, m);
+            if (quantized) {
+                for (size_t group_id = 0; group_id < S / group_size; group_id++) {
+                    attn_dequant_u8(past_k.ptr<uint8_t>(b_kv, h, m, group_id * group_size),
+                                    dst + group_id * group_size,
+                                    group_size,
+                                    scale_zp.ptr<float>(m, b_kv, h, group_id * 2)[0],
+                                    scale_zp.ptr<float>(m, b_kv, h, group_id * 2)[1]);
+                }
+            } else {
+                cpu_convert(past_k.ptr_v(b_kv, h, m), dst, past_k.m_dt, ov::element::f32, S);
+            }
+        });
+        for (size_t b = 0; b < B; b++) {
+            for (size_t m = 0; m < m_sink_size; m++) {
+                beam_table_k.at<int32_t>({b, m}) = b;
+                beam_table_v.at<int32_t>({b, m}) = b;
+            }
+        }
+    }
+
+    // llama-style rotation by the same angles for all the sink tokens: [cos(S / 2) | sin(S / 2)]
+    const size_t half = S / 2;
+    std::vector<float> coefficients(m_sink_size * S);
+    for (size_t i = 0; i < half; i++) {
+        const double inv_freq = std::pow(static_cast<double>(m_rope_theta), -2.0 * static_cast<double>(i) / S);
+        const double angle = static_cast<double>(window.evicted) * inv_freq;
+        coefficients[i] = static_cast<float>(std::cos(angle));
+        coefficients[half + i] = static_cast<float>(std::sin(angle));
+    }
+    for (size_t m = 1; m < m_sink_size; m++) {
+        std::memcpy(coefficients.data() + m * S, coefficients.data(), S * sizeof(float));
+    }
+
+    parallel_for(B, [&](size_t b) {
+        const auto* sink_keys = window.sink_keys.ptr<float>(b);
+        std::vector<float> keys(sink_keys, sink_keys + H * m_sink_size * S);
+        rotate_kv_cache_block(keys.data(), coefficients.data(), H, m_sink_size, S);
+        for (size_t h = 0; h < H; h++) {
+            for (size_t m = 0; m < m_sink_size; m++) {
+                const auto* src = keys.data() + (h * m_sink_size + m) * S;
+                if (quantized) {
+                    for (size_t group_id = 0; group_id < S / group_size; group_id++) {
+                        attn_quant_u8(src + group_id * group_size,
+                                      past_k.ptr<uint8_t>(b, h, m, group_id * group_size),
+                                      group_size,
+                                      scale_zp.at<float>({m, b, h, group_id * 2}),
+                                      scale_zp.at<float>({m, b, h, group_id * 2 + 1}));
+                    }
+                } else {
+                    cpu_convert(src, past_k.ptr_v(b, h, m), ov::element::f32, past_k.m_dt, S);
+                }
+            }
+        }
+    });
+}
+
+MemoryPtr ScaledDotProductAttention::remapAttnMask(const MemoryPtr& mem_mask) {
+    const auto& window = m_k_state->window_state();
+    const size_t present_len = m_k_state->hidden_state_mem()->getStaticDims()[1];
+    const auto& dims = mem_mask->getStaticDims();
+    if (dims.empty() || any_of(dims.back(), present_len, 1U)) {
+        return mem_mask;
+    }
+    const size_t total_len = dims.back();
+    CPU_NODE_ASSERT(total_len == present_len + window.evicted,
+                    "expects the attention mask over ",
+                    present_len,
+                    " cached tokens or ",
+                    present_len + window.evicted,
+                    " tokens of the sequence, but gets ",
+                    total_len);
+
+    // the position of the token in every slot, the tokens after the window are the current ones
+    auto& positions = m_mask_positions;
+    positions.resize(present_len);
+    const size_t window_end = m_sink_size + m_window_size;
+    for (size_t slot = 0; slot < present_len; slot++) {
+        if (slot < m_sink_size) {
+            positions[slot] = slot;
+        } else if (window.ring_offset > 0 && slot < window_end) {
+            const size_t idx = (slot - m_sink_size + m_window_size - window.ring_offset) % m_window_size;
+            positions[slot] = m_sink_size + window.evicted + idx;
+        } else {
+            positions[slot] = window.evicted + slot;
+        }
+    }
+
+    // the mask is remapped on every decoding step, so the scratch memory only grows
+    VectorDims new_dims = dims;
+    new_dims.back() = present_len;
+    auto new_desc = std::make_shared<CpuBlockedMemoryDesc>(mem_mask->getDesc().getPrecision(), Shape(new_dims));
+    if (!m_remapped_mask) {
+        m_remapped_mask = std::make_shared<Memory>(getEngine(), new_desc);
+    } else {
+        m_remapped_mask->redefineDesc(new_desc);
+    }
+    const auto& new_mask = m_remapped_mask;
+    const size_t element_size = mem_mask->getDesc().getPrecision().size();
+    const size_t rows = mem_mask->getShape().getElementsCount() / total_len;
+    const auto* src = mem_mask->getDataAs<const uint8_t>();
+    auto* dst = new_mask->getDataAs<uint8_t>();
+    parallel_for(rows, [&](size_t r) {
+        for (size_t slot = 0; slot < present_len; slot++) {
+            std::memcpy(dst + (r * present_len + slot) * element_size,
+                        src + (r * total_len + positions[slot]) * element_size,
+                        element_size);
+        }
+    });
+    return new_mask;
+}
+
 ov::element::Type ScaledDotProductAttention::getKVCachePrecision() {
     ov::element::Type kvcache_precision;
     // TODO: SDPA only supports same key/value cache precision.
@@ -78,6 +78,11 @@ private:
     void updatePastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v);
     ov::element::Type getRuntimePrecision() const override;
     void resetBeamTablePastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v, const MemoryPtr& mem_beam_idx);
+    // bounded KV-cache: evicts the oldest window tokens after the attention, moves the sink keys to the new positions
+    void evictPastkv();
+    void rotateSinkKeys();
+    // gathers the columns of the attention mask over all the tokens of the sequence to the slots of the bounded cache
+    MemoryPtr remapAttnMask(const MemoryPtr& mem_mask);
 
     struct Config {
         ScaledDotProductAttentionWithKVCache::Config config;
@@ -110,6 +115,13 @@ private:
     std::vector<size_t> m_kvstate_layout = {2, 0, 1, 3};
     SDPAQuantParam m_key_quant_param;
     SDPAQuantParam m_value_quant_param;
+    // attention sinks + sliding window of the stateful KV-cache, disabled if m_window_size is 0
+    size_t m_sink_size = 0;
+    size_t m_window_size = 0;
+    float m_rope_theta = 0.0F;
+    // scratch of remapAttnMask
+    MemoryPtr m_remapped_mask;
+    std::vector<size_t> m_mask_positions;
 };
 
 }  // namespace ov::intel_cpu::node
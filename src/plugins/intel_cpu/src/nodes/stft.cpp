@@ -4,10 +4,8 @@
 
 #include "stft.h"
 
-#include <algorithm>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
@@ -147,32 +145,18 @@ void STFT::execute([[maybe_unused]] const dnnl::stream& strm) {
         dst = dst_mem->getDataAs<float>();
     }
 
-    parallel_for2d(batch_size, num_frames, [&](size_t batch, size_t frame_idx) {
-        size_t batch_in_start = batch * signal_length;
-        size_t batch_frames_out = batch * num_frames;
-
-        const auto frame_start = batch_in_start + frame_idx * frame_step;
-        const auto frame_end = frame_start + frame_size;
-        std::vector<float> signal_slice(signal + frame_start, signal + frame_end);
-        std::transform(signal_slice.begin(),
-                       signal_slice.end(),
-                       pad_window.begin(),
-                       signal_slice.begin(),
-                       std::multiplies<>());
-
-        const auto result_idx = (batch_frames_out + frame_idx) * fft_out_shape_size;
-        auto twiddles = rdft_executor->generateTwiddles({static_cast<int>(signal_slice.size())}, fft_out_shape, {0});
-        rdft_executor->execute(signal_slice.data(),
-                               dst + result_idx,
-                               twiddles,
-                               1,
-                               {0},
-                               {static_cast<int>(frame_size)},
-                               {frame_size_dim},
-                               fft_out_shape,
-                               {1},
-                               {2, 1});
-    });
+    // the twiddles are shared by all the frames, the frames of a batch are transformed by one call
+    const auto twiddles = rdft_executor->generateTwiddles({static_cast<int>(frame_size)}, fft_out_shape, {0});
+    for (size_t batch = 0; batch < batch_size; batch++) {
+        rdft_executor->executeFrames(signal + batch * signal_length,
+                                     dst + batch * num_frames * fft_out_shape_size,
+                                     twiddles[0],
+                                     num_frames,
+                                     frame_size_dim,
+                                     static_cast<size_t>(frame_step),
+                                     fft_out_shape_size,
+                                     pad_window.data());
+    }
     if (m_transpose_frames) {
         const auto stft_transp_out_shape = VectorDims{batch_size, fft_out_shape[0], num_frames, fft_out_shape[1]};
         transpose_out4d(reinterpret_cast<const uint8_t*>(dst),
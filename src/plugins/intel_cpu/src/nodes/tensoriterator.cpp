@@ -11,6 +11,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <numeric>
@@ -245,11 +246,15 @@ private:
     int value;
 };
 
-DynamicBuffer::DynamicBuffer(MemoryPtr from_, std::vector<MemoryPtr> to_, const PortMap& map_rule_)
+DynamicBuffer::DynamicBuffer(MemoryPtr from_,
+                             std::vector<MemoryPtr> to_,
+                             const PortMap& map_rule_,
+                             bool in_place_allowed_)
     : from(std::move(from_)),
       to(std::move(to_)),
       map_rule(map_rule_),
-      elem_size(DnnlExtensionUtils::sizeOfDataType(from->getDataType())) {}
+      elem_size(DnnlExtensionUtils::sizeOfDataType(from->getDataType())),
+      in_place_allowed(in_place_allowed_) {}
 
 void DynamicBuffer::execute(const dnnl::engine& eng, const int iter) {
     OPENVINO_ASSERT(from->getStaticDims()[map_rule.axis] == static_cast<size_t>(std::abs(map_rule.stride)),
@@ -282,22 +287,33 @@ void DynamicBuffer::init(const dnnl::engine& eng) {
     // We have no idea of "from" node memory dims until the sub_graph has been executed.
     const auto& src_mem = from->getPrimitive();
     const auto& src_desc = src_mem.get_desc();
-    const auto& dims = src_desc.get_dims();
+    auto dims = src_desc.get_dims();
     count = std::accumulate(dims.begin(), dims.begin() + map_rule.axis, static_cast<size_t>(1), std::multiplies<>());
     len = std::accumulate(dims.begin() + map_rule.axis + 1, dims.end(), elem_size, std::multiplies<>());
     chunk_unit_in_byte = abs_stride * len;
 
-    if (!mem_holder_buffer) {  // else reuse buffer holder of last inference
+    // The output shape is bounded by the trip count, so the output memory itself can hold all the iterations.
+    // Shrinking it after an early exit does not reallocate, thus the concatenated data never has to be moved.
+    write_in_place = in_place_allowed && max_iter_count > 0;
+    if (write_in_place) {
+        dims[map_rule.axis] = abs_stride * max_iter_count;
+        const auto desc = to.front()->getDescPtr()->cloneWithNewDims(DnnlExtensionUtils::convertToVectorDims(dims));
+        redefineToMemories(to, desc);
+    } else if (!mem_holder_buffer) {  // else reuse buffer holder of last inference
         // preallocate a large chunk of memory to hold intermediate concated outputs of all iterations.
         mem_holder_buffer = create_buffer(eng);
     }
 
     // reset chunk_offset_in_byte since the first execution
-    chunk_stride_in_byte = mem_holder_buffer->getSize() / count;
+    chunk_stride_in_byte = buffer()->getSize() / count;
     chunk_offset_in_byte = stride > 0 ? 0 : (chunk_stride_in_byte - chunk_unit_in_byte);
     num_execs = 0;
 }
 
+const MemoryPtr& DynamicBuffer::buffer() const {
+    return write_in_place ? to.front() : mem_holder_buffer;
+}
+
 bool DynamicBuffer::check_buffer() const {
     if (map_rule.stride > 0) {
         if (static_cast<ptrdiff_t>(chunk_offset_in_byte + chunk_unit_in_byte) > chunk_stride_in_byte) {
@@ -315,12 +331,10 @@ MemoryPtr DynamicBuffer::create_buffer(const dnnl::engine& eng) {
     const auto abs_stride = std::abs(map_rule.stride);
 
     const auto estimate_iters = [&]() {
-        if (max_iter_count != -1) {
-            return max_iter_count;
-        }
-
-        // in case of no idea of memory upper boundary
-        return (num_execs == 0) ? 1 : 2 * num_execs;  // growth factor 2
+        // in case of no idea of memory upper boundary grow geometrically, so the total amount of
+        // copied data stays linear in the number of iterations
+        const auto grown_iters = (num_execs == 0) ? 1 : 2 * num_execs;  // growth factor 2
+        return std::max(max_iter_count, grown_iters);
     };
     const auto estimated_iters = estimate_iters();
     const Shape _shape = Shape({count, static_cast<size_t>(abs_stride * estimated_iters), len / elem_size});
@@ -342,7 +356,7 @@ void DynamicBuffer::move_buffer(const MemoryPtr& new_buffer) {
     const auto src_offset_in_byte = stride > 0 ? 0 : (src_stride - valid_size);
     chunk_offset_in_byte = stride > 0 ? 0 : (dst_stride - valid_size);  // reset chunk_offset_in_byte
 
-    copy(mem_holder_buffer->getDataAs<uint8_t>() + src_offset_in_byte,
+    copy(buffer()->getDataAs<uint8_t>() + src_offset_in_byte,
          new_buffer->getDataAs<uint8_t>() + chunk_offset_in_byte,
          src_stride,
          dst_stride,
@@ -351,6 +365,7 @@ void DynamicBuffer::move_buffer(const MemoryPtr& new_buffer) {
 
     // assign mem_holder_buffer
     mem_holder_buffer = new_buffer;
+    write_in_place = false;
     chunk_stride_in_byte = mem_holder_buffer->getSize() / count;
 
     // adjust for next execution
@@ -366,7 +381,7 @@ void DynamicBuffer::move_data() {
     const auto dst_stride = chunk_stride_in_byte;
 
     copy(from->getDataAs<const uint8_t>(),
-         mem_holder_buffer->getDataAs<uint8_t>() + chunk_offset_in_byte,
+         buffer()->getDataAs<uint8_t>() + chunk_offset_in_byte,
          src_stride,
          dst_stride,
          count,
@@ -382,7 +397,7 @@ void DynamicBuffer::move_data() {
 }
 
 void DynamicBuffer::transfer(const Node* node) {
-    if (mem_holder_buffer && num_execs > 0) {
+    if (buffer() && num_execs > 0) {
         const auto axis = map_rule.axis;
         const auto stride = map_rule.stride;
         const auto abs_stride = std::abs(stride);
@@ -394,19 +409,32 @@ void DynamicBuffer::transfer(const Node* node) {
         const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)
                               ->cloneWithNewDims(DnnlExtensionUtils::convertToVectorDims(dims));
 
-        redefineToMemories(to, desc);
-
         const auto src_stride = chunk_stride_in_byte;
-        const auto dst_stride = to.front()->getStaticDims()[axis] * len;
         const auto valid_size = chunk_unit_in_byte * num_execs;
         const auto src_offset_in_byte = stride > 0 ? 0 : (src_stride - valid_size);
 
-        copy(mem_holder_buffer->getDataAs<uint8_t>() + src_offset_in_byte,
-             to.front()->getDataAs<uint8_t>(),
-             src_stride,
-             dst_stride,
-             count,
-             dst_stride);
+        if (write_in_place) {
+            // the data is already in the output memory, it only has to be packed if the loop exited early
+            if (static_cast<ptrdiff_t>(valid_size) != src_stride) {
+                compact(to.front()->getDataAs<uint8_t>(),
+                        src_offset_in_byte,
+                        src_stride,
+                        valid_size,
+                        count,
+                        valid_size);
+            }
+            redefineToMemories(to, desc);
+        } else {
+            redefineToMemories(to, desc);
+
+            const auto dst_stride = to.front()->getStaticDims()[axis] * len;
+            copy(mem_holder_buffer->getDataAs<uint8_t>() + src_offset_in_byte,
+                 to.front()->getDataAs<uint8_t>(),
+                 src_stride,
+                 dst_stride,
+                 count,
+                 dst_stride);
+        }
     } else {
         VectorDims newDims = to.front()->getShape().getDims();
         nullifyUndefinedDims(newDims);
@@ -414,6 +442,9 @@ void DynamicBuffer::transfer(const Node* node) {
         const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(newDims);
         redefineToMemories(to, desc);
     }
+
+    // the state is consumed, an inference without iterations must not transfer it again
+    num_execs = 0;
 }
 
 void DynamicBuffer::copy(const uint8_t* src,
@@ -427,6 +458,19 @@ void DynamicBuffer::copy(const uint8_t* src,
     });
 }
 
+void DynamicBuffer::compact(uint8_t* data,
+                            const size_t src_offset,
+                            const size_t src_stride,
+                            const size_t dst_stride,
+                            const size_t count,
+                            const size_t len) {
+    // The source of each row never precedes its destination, so the rows are moved sequentially in ascending order
+    // to not overwrite data which hasn't been moved yet.
+    for (size_t i = 0; i < count; i++) {
+        std::memmove(data + i * dst_stride, data + src_offset + i * src_stride, len);
+    }
+}
+
 bool TensorIterator::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
                                           std::string& errorMessage) noexcept {
     try {
@@ -796,7 +840,7 @@ void TensorIterator::prepareDynamicBuffers() {
         if (map_rule.axis != -1) {
             auto to_mems = getToMemories(this, map_rule.from);
             auto& from_mem = output_mem[map_rule.to];
-            buffers.emplace_back(std::make_shared<DynamicBuffer>(from_mem, to_mems, map_rule));
+            buffers.emplace_back(std::make_shared<DynamicBuffer>(from_mem, to_mems, map_rule, isDynamicNode()));
         }
     }
 }
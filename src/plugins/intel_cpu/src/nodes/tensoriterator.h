@@ -70,11 +70,15 @@ protected:
 
 /**
  * Class for storing intermediate output buffer state for dynamism when we don't know
- * final output shape but we should concatenate output after each iteration
+ * final output shape but we should concatenate output after each iteration.
+ * When the upper bound of iterations is known and the output memory may be resized, each iteration
+ * is written straight into its final slice of the output memory, so no extra copy is made after the loop.
+ * Otherwise the data is accumulated in an internal buffer which grows geometrically and is reused
+ * across inferences.
  */
 class DynamicBuffer {
 public:
-    DynamicBuffer(MemoryPtr from_, std::vector<MemoryPtr> to_, const PortMap& map_rule_);
+    DynamicBuffer(MemoryPtr from_, std::vector<MemoryPtr> to_, const PortMap& map_rule_, bool in_place_allowed_);
 
     void execute(const dnnl::engine& eng, int iter);
     void transfer(const Node* node);
@@ -89,8 +93,15 @@ private:
     MemoryPtr create_buffer(const dnnl::engine& eng);
     void move_buffer(const MemoryPtr& new_buffer);
     void move_data();
+    [[nodiscard]] const MemoryPtr& buffer() const;
 
     static void copy(const uint8_t* src, uint8_t* dst, size_t src_stride, size_t dst_stride, size_t count, size_t len);
+    static void compact(uint8_t* data,
+                        size_t src_offset,
+                        size_t src_stride,
+                        size_t dst_stride,
+                        size_t count,
+                        size_t len);
 
     /* variable states */
     size_t len = 1lu;
@@ -101,12 +112,14 @@ private:
     size_t chunk_unit_in_byte = 0lu;  // the amount of bytes copied per each count per each execution (iteration)
     int num_execs = 0lu;              // number of executions happened
     int max_iter_count = -1;          // estimated maximum iter count
+    bool write_in_place = false;      // iterations are written directly into the output memory
 
     /* invariable states */
     MemoryPtr from;
     std::vector<MemoryPtr> to;
     PortMap map_rule;
     size_t elem_size = 0lu;
+    bool in_place_allowed = false;  // the output memory can be redefined to the upper bound shape
 
     MemoryPtr mem_holder_buffer;
 };
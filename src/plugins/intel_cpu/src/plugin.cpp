@@ -622,6 +622,8 @@ std::shared_ptr<ov::ICompiledModel> Plugin::deserialize_model(ModelDeserializer&
         _config.erase(it);
     }
     conf.readProperties(_config, modelType);
+    conf.weightsSubnormalsFlushed = model->has_rt_info(weights_subnormals_flushed_key) &&
+                                    model->get_rt_info<bool>(weights_subnormals_flushed_key);
 
     // import config props from caching model
     calculate_streams(conf, model, true);
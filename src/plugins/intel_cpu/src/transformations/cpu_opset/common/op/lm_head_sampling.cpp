@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "lm_head_sampling.hpp"
+
+#include <cstddef>
+#include <memory>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "transformations/itt.hpp"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu {
+
+void LMHeadSamplingNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(LMHeadSampling_validate_and_infer_types);
+    const size_t expected_inputs =
+        2 + static_cast<size_t>(m_config.quantized) + static_cast<size_t>(m_config.repetition_penalty != 1.0F);
+    NODE_VALIDATION_CHECK(this, get_input_size() == expected_inputs);
+    NODE_VALIDATION_CHECK(this, m_config.top_k >= 0, "top_k must be non-negative");
+    NODE_VALIDATION_CHECK(this, m_config.top_p > 0.0F && m_config.top_p <= 1.0F, "top_p must be in (0, 1]");
+    NODE_VALIDATION_CHECK(this, m_config.temperature > 0.0F, "temperature must be positive");
+    NODE_VALIDATION_CHECK(this, m_config.repetition_penalty > 0.0F, "repetition_penalty must be positive");
+    NODE_VALIDATION_CHECK(this,
+                          any_of(m_config.output_type, ov::element::i32, ov::element::i64),
+                          "output type must be i32 or i64");
+
+    const auto& ishape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this,
+                          ishape.rank().is_static() && ishape.rank().get_length() >= 2,
+                          "hidden rank must be >= 2");
+    NODE_VALIDATION_CHECK(this,
+                          ishape[ishape.size() - 1].compatible(m_config.hidden_size),
+                          "hidden size doesn't match");
+    NODE_VALIDATION_CHECK(this, get_input_element_type(0).is_real(), "hidden data type must be real");
+
+    const auto& wshape = get_input_partial_shape(1);
+    NODE_VALIDATION_CHECK(this,
+                          wshape.compatible(ov::PartialShape{m_config.vocab_size, m_config.hidden_size}),
+                          "weight shape must be [vocab_size, hidden_size]");
+
+    auto tokens_shape = ishape;
+    tokens_shape[tokens_shape.size() - 1] = 1;
+    set_output_type(0, m_config.output_type, tokens_shape);
+    if (m_config.with_logits) {
+        auto logits_shape = ishape;
+        logits_shape[logits_shape.size() - 1] = m_config.vocab_size;
+        set_output_type(1, get_input_element_type(0), logits_shape);
+    }
+}
+
+std::shared_ptr<Node> LMHeadSamplingNode::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(LMHeadSampling_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<LMHeadSamplingNode>(new_args, m_config);
+}
+
+bool LMHeadSamplingNode::visit_attributes(ov::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(LMHeadSamplingNode_visit_attributes);
+    visitor.start_structure("config");
+    visitor.on_attribute("quantized", m_config.quantized);
+    visitor.on_attribute("with_logits", m_config.with_logits);
+    visitor.on_attribute("vocab_size", m_config.vocab_size);
+    visitor.on_attribute("hidden_size", m_config.hidden_size);
+    visitor.on_attribute("top_k", m_config.top_k);
+    visitor.on_attribute("top_p", m_config.top_p);
+    visitor.on_attribute("temperature", m_config.temperature);
+    visitor.on_attribute("repetition_penalty", m_config.repetition_penalty);
+    visitor.on_attribute("global_seed", m_config.global_seed);
+    visitor.on_attribute("op_seed", m_config.op_seed);
+    visitor.on_attribute("output_type", m_config.output_type);
+    visitor.finish_structure();
+    return true;
+}
+
+}  // namespace ov::intel_cpu
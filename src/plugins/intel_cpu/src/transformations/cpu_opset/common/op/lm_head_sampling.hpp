@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/op.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * The last step of the LLM decoding: the vocabulary projection of the hidden states followed by the sampling of
+ * the next token from softmax(penalized(logits) / temperature), restricted to the top_k most probable tokens
+ * (0 - all the vocabulary) and then to the smallest set of them with the cumulative probability >= top_p.
+ * top_k == 1 is the greedy decoding. The random numbers are generated the same way as by Multinomial.
+ */
+class LMHeadSamplingNode : public ov::op::Op {
+public:
+    OPENVINO_OP("LMHeadSampling", "cpu_plugin_opset");
+
+    LMHeadSamplingNode() = default;
+
+    struct Config {
+        bool quantized;
+        bool with_logits;  // the logits are also required as the second output
+        int vocab_size;
+        int hidden_size;
+        int top_k;
+        float top_p;
+        float temperature;
+        float repetition_penalty;
+        uint64_t global_seed;
+        uint64_t op_seed;
+        ov::element::Type output_type;
+    };
+
+    // args:
+    //      0: hidden         [..., hidden_size]
+    //      1: weight         [vocab_size, hidden_size]
+    //   quantized (int8 weights, f32 scales per output channel):
+    //      2: scales         [vocab_size, 1]
+    //   repetition_penalty != 1:
+    //      last: the previous tokens [batch, ?], the negative ids are ignored
+    // outputs:
+    //      0: tokens         [..., 1]
+    //      1: logits         [..., vocab_size] (with_logits)
+    LMHeadSamplingNode(const OutputVector& args, const Config& cfg) : Op(args), m_config(cfg) {
+        validate_and_infer_types();
+    }
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    const Config& get_config() const {
+        return m_config;
+    }
+
+private:
+    Config m_config{};
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,263 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "lm_head_sampling_fusion.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multinomial.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/topk.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "transformations/cpu_opset/common/op/lm_head_sampling.hpp"
+#include "transformations/utils/gen_pattern.hpp"
+#include "utils/general_utils.h"
+
+using namespace ov::gen_pattern;
+using namespace ov::pass;
+
+namespace {
+
+struct WeightPattern {
+    std::shared_ptr<ov::Node> weight;  // the constant in the original precision
+    std::shared_ptr<ov::Node> weight_i8;
+    std::shared_ptr<ov::Node> scales;
+    std::shared_ptr<ov::Node> pattern;
+};
+
+// f32 | f16/bf16 -> Convert | symmetrically quantized i8 -> Convert -> Multiply(scales per OC)
+WeightPattern makeWeightPattern() {
+    WeightPattern w;
+    w.weight = makePattern<ov::op::v0::Constant>({});
+    auto weight_cvt = makePattern<ov::op::v0::Convert>({w.weight}, {{"destination_type", "f32"}});
+    w.weight_i8 = makeConst(ov::element::i8, ov::PartialShape::dynamic(2), nullptr);
+    w.scales = makeConst(ov::element::f32, ov::PartialShape({ov::Dimension(), 1}), nullptr);
+    auto weight_i8_f32 = makePattern<ov::op::v0::Convert>({w.weight_i8}, {{"destination_type", "f32"}});
+    auto weight_deq = makePattern<ov::op::v1::Multiply>({weight_i8_f32, w.scales}, {{"auto_broadcast", "numpy"}});
+    w.pattern = weight_cvt | w.weight | weight_deq;
+    return w;
+}
+
+bool is_last_axis(int64_t axis, const ov::PartialShape& shape) {
+    const auto rank = shape.rank().get_length();
+    return axis == rank - 1 || axis == -1;
+}
+
+bool softmax_on_last_axis(const std::shared_ptr<ov::Node>& softmax) {
+    const auto& shape = softmax->get_input_partial_shape(0);
+    if (const auto softmax_v1 = ov::as_type_ptr<ov::op::v1::Softmax>(softmax)) {
+        return is_last_axis(static_cast<int64_t>(softmax_v1->get_axis()), shape);
+    }
+    const auto softmax_v8 = ov::as_type_ptr<ov::op::v8::Softmax>(softmax);
+    return softmax_v8 && is_last_axis(softmax_v8->get_axis(), shape);
+}
+
+// a single sample drawn from the probabilities
+bool is_single_sample(const std::shared_ptr<ov::op::v13::Multinomial>& multinomial) {
+    const auto num_samples = ov::as_type_ptr<ov::op::v0::Constant>(multinomial->get_input_node_shared_ptr(1));
+    return num_samples && ov::shape_size(num_samples->get_shape()) == 1 &&
+           num_samples->cast_vector<int64_t>()[0] == 1 && !multinomial->get_log_probs();
+}
+
+bool has_single_consumer(const ov::Output<ov::Node>& output) {
+    return output.get_target_inputs().size() == 1;
+}
+
+}  // namespace
+
+ov::intel_cpu::LMHeadSamplingFusion::LMHeadSamplingFusion() {
+    MATCHER_SCOPE(LMHeadSamplingFusion);
+
+    auto hidden = makePattern();
+    auto lm_head_w = makeWeightPattern();
+    auto logits =
+        makePattern<op::v0::MatMul>({hidden, lm_head_w.pattern}, {{"transpose_a", false}, {"transpose_b", true}});
+    auto temperature = makePattern<op::v0::Constant>({});
+    auto divided = makePattern<op::v1::Divide>({logits, temperature});
+    auto multiplied = makePattern<op::v1::Multiply>({logits, temperature});
+    auto scores = divided | multiplied | logits;
+
+    // greedy
+    auto greedy_topk = makePattern<op::v11::TopK>({scores, makePattern<op::v0::Constant>({})});
+    greedy_topk->set_output_size(2);
+
+    // top-k sampling
+    auto sample_topk = makePattern<op::v11::TopK>({scores, makePattern<op::v0::Constant>({})});
+    sample_topk->set_output_size(2);
+    auto topk_probs =
+        makePattern<op::v1::Softmax>({sample_topk->output(0)}) | makePattern<op::v8::Softmax>({sample_topk->output(0)});
+    auto topk_sample = makePattern<op::v13::Multinomial>({topk_probs, makePattern<op::v0::Constant>({})});
+    auto topk_token =
+        makePattern<op::v8::Gather>({sample_topk->output(1), topk_sample, makePattern<op::v0::Constant>({})});
+
+    // sampling from all the vocabulary
+    auto probs = makePattern<op::v1::Softmax>({scores}) | makePattern<op::v8::Softmax>({scores});
+    auto sample = makePattern<op::v13::Multinomial>({probs, makePattern<op::v0::Constant>({})});
+
+    auto result = greedy_topk | topk_token | sample;
+
+    matcher_pass_callback callback = [OV_CAPTURE_CPY_AND_THIS](ov::pass::pattern::Matcher& m) {
+        PatternValidator validator(m);
+        if (!validator) {
+            return false;
+        }
+
+        const auto& pattern_map = m.get_pattern_value_map();
+        auto root = m.get_match_root();
+        const auto src = pattern_map.at(hidden);
+        if (!src.get_element_type().is_real() || src.get_partial_shape().size() < 2) {
+            return false;
+        }
+
+        const bool quantized = pattern_map.count(lm_head_w.weight_i8) > 0;
+        const auto weight = pattern_map.at(quantized ? lm_head_w.weight_i8 : lm_head_w.weight);
+        if (!weight.get_partial_shape().is_static() || weight.get_shape().size() != 2) {
+            return false;
+        }
+        const auto vocab_size = weight.get_shape()[0];
+        const auto hidden_size = weight.get_shape()[1];
+        if (!src.get_partial_shape()[src.get_partial_shape().size() - 1].compatible(hidden_size)) {
+            return false;
+        }
+
+        LMHeadSamplingNode::Config config{};
+        config.quantized = quantized;
+        config.vocab_size = static_cast<int>(vocab_size);
+        config.hidden_size = static_cast<int>(hidden_size);
+        config.top_p = 1.0F;
+        config.temperature = 1.0F;
+        config.repetition_penalty = 1.0F;
+
+        // the scores are the logits scaled by the positive scalar
+        const auto logits_out = pattern_map.at(logits);
+        auto scores_out = logits_out;
+        for (const auto& scaled : {divided, multiplied}) {
+            if (pattern_map.count(scaled) == 0) {
+                continue;
+            }
+            scores_out = pattern_map.at(scaled);
+            const auto value = ov::as_type_ptr<op::v0::Constant>(pattern_map.at(temperature).get_node_shared_ptr());
+            if (ov::shape_size(value->get_shape()) != 1 || !has_single_consumer(scores_out)) {
+                return false;
+            }
+            const auto factor = value->cast_vector<float>()[0];
+            if (!(factor > 0.0F)) {
+                return false;
+            }
+            config.temperature = scaled == divided ? factor : 1.0F / factor;
+        }
+
+        NodeVector fused_nodes{logits_out.get_node_shared_ptr()};
+        if (scores_out != logits_out) {
+            fused_nodes.push_back(scores_out.get_node_shared_ptr());
+        }
+
+        // the first fused node after the scores
+        std::shared_ptr<ov::Node> scores_consumer;
+        if (const auto topk = ov::as_type_ptr<op::v11::TopK>(root)) {
+            // the values of the greedy TopK are not used
+            if (topk->get_k() != 1 || topk->get_mode() != op::v11::TopK::Mode::MAX ||
+                !is_last_axis(static_cast<int64_t>(topk->get_axis()), topk->get_input_partial_shape(0)) ||
+                !topk->output(0).get_target_inputs().empty()) {
+                return false;
+            }
+            config.top_k = 1;
+            config.output_type = topk->get_index_element_type();
+            scores_consumer = topk;
+        } else {
+            // Multinomial supports 2D probabilities only
+            if (src.get_partial_shape().size() != 2) {
+                return false;
+            }
+            const auto multinomial = ov::as_type_ptr<op::v13::Multinomial>(
+                pattern_map.at(pattern_map.count(topk_sample) ? topk_sample : sample).get_node_shared_ptr());
+            const auto softmax = multinomial->get_input_node_shared_ptr(0);
+            if (!is_single_sample(multinomial) || !softmax_on_last_axis(softmax) ||
+                !has_single_consumer(softmax->output(0))) {
+                return false;
+            }
+            config.global_seed = multinomial->get_global_seed();
+            config.op_seed = multinomial->get_op_seed();
+            config.output_type = root->get_output_element_type(0);
+            fused_nodes.push_back(softmax);
+            fused_nodes.push_back(multinomial);
+
+            if (const auto gather = ov::as_type_ptr<op::v8::Gather>(root)) {
+                const auto topk = ov::as_type_ptr<op::v11::TopK>(pattern_map.at(sample_topk).get_node_shared_ptr());
+                // the samples index the candidates in the descending order of the scores
+                if (gather->get_batch_dims() != 1 || gather->get_axis() != 1 || topk->get_k() == 0 ||
+                    topk->get_mode() != op::v11::TopK::Mode::MAX ||
+                    topk->get_sort_type() != op::v11::TopK::SortType::SORT_VALUES ||
+                    !is_last_axis(static_cast<int64_t>(topk->get_axis()), topk->get_input_partial_shape(0)) ||
+                    !has_single_consumer(topk->output(0)) || !has_single_consumer(topk->output(1)) ||
+                    !has_single_consumer(multinomial->output(0))) {
+                    return false;
+                }
+                config.top_k = static_cast<int>(topk->get_k());
+                fused_nodes.push_back(topk);
+                scores_consumer = topk;
+            } else {
+                config.top_k = 0;
+                scores_consumer = softmax;
+            }
+        }
+        if (!any_of(config.output_type, ov::element::i32, ov::element::i64)) {
+            return false;
+        }
+        fused_nodes.push_back(root);
+
+        // the logits are computed anyway when something else consumes them
+        const auto* logits_consumer = scores_out != logits_out ? scores_out.get_node() : scores_consumer.get();
+        std::vector<ov::Input<ov::Node>> logits_consumers;
+        for (const auto& input : logits_out.get_target_inputs()) {
+            if (input.get_node() != logits_consumer) {
+                logits_consumers.push_back(input);
+            }
+        }
+        config.with_logits = !logits_consumers.empty();
+
+        OutputVector new_args{src, weight};
+        if (quantized) {
+            new_args.push_back(pattern_map.at(lm_head_w.scales));
+        }
+        auto new_node = std::make_shared<LMHeadSamplingNode>(new_args, config);
+        new_node->set_friendly_name(root->get_friendly_name());
+        ov::copy_runtime_info(fused_nodes, new_node);
+        // callback is for plugin implementation to check if it can be supported
+        if (!transformation_callback(new_node)) {
+            return false;
+        }
+
+        root->output(ov::is_type<op::v11::TopK>(root) ? 1 : 0).replace(new_node->output(0));
+        if (config.with_logits) {
+            for (auto& input : logits_consumers) {
+                input.replace_source_output(new_node->output(1));
+            }
+            new_node->output(1).get_tensor().add_names(logits_out.get_names());
+        }
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(result, matcher_name);
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,28 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/matcher_pass.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Fuses the vocabulary projection and the token selection at the end of the LLM decoding step into LMHeadSampling,
+ * so the logits are not written and reread by the separate nodes:
+ *
+ *   scores = MatMul(hidden, weight^T) [/ temperature]
+ *   greedy:         TopK(scores, 1).indices
+ *   top-k sampling: Gather(TopK(scores, k).indices, Multinomial(Softmax(TopK(scores, k).values), 1), batch_dims=1)
+ *   sampling:       Multinomial(Softmax(scores), 1)
+ *
+ * The other consumers of the logits are connected to the logits output of the fused node.
+ */
+class LMHeadSamplingFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("LMHeadSamplingFusion");
+    LMHeadSamplingFusion();
+};
+
+}  // namespace ov::intel_cpu
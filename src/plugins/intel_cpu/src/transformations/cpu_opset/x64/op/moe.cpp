@@ -0,0 +1,54 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "moe.hpp"
+
+#include <memory>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "transformations/itt.hpp"
+
+namespace ov::intel_cpu {
+
+void MoENode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(MoE_validate_and_infer_types);
+    const auto input_size = get_input_size();
+    NODE_VALIDATION_CHECK(this, input_size == (m_config.quantized ? 8 : 5));
+
+    const auto& ishape = get_input_partial_shape(0);
+    const auto& itype = get_input_element_type(0);
+    NODE_VALIDATION_CHECK(this, ishape.rank().is_static() && ishape.rank() == 2, "feature shape rank must be 2");
+    NODE_VALIDATION_CHECK(this,
+                          ishape[1].compatible(m_config.hidden_size),
+                          "feature size doesn't match the hidden size");
+    NODE_VALIDATION_CHECK(this, itype.is_real(), "feature data type must be real");
+
+    const auto& rshape = get_input_partial_shape(1);
+    NODE_VALIDATION_CHECK(this,
+                          rshape.rank().is_static() && rshape.rank() == 3 && rshape[0].compatible(m_config.experts),
+                          "routing shape must be [experts, tokens, 1]");
+
+    set_output_type(0, itype, ishape);
+}
+
+std::shared_ptr<Node> MoENode::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(MoE_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<MoENode>(new_args, m_config);
+}
+
+bool MoENode::visit_attributes(ov::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(MoENode_visit_attributes);
+    visitor.start_structure("config");
+    visitor.on_attribute("quantized", m_config.quantized);
+    visitor.on_attribute("experts", m_config.experts);
+    visitor.on_attribute("hidden_size", m_config.hidden_size);
+    visitor.on_attribute("intermediate_size", m_config.intermediate_size);
+    visitor.finish_structure();
+    return true;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/op/op.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Mixture of Experts block: sum over the experts of routing[e, t] * down_e(silu(gate_e(x_t)) * up_e(x_t)).
+ * The experts with zero routing weights for the token are not computed.
+ */
+class MoENode : public ov::op::Op {
+public:
+    OPENVINO_OP("MoE", "cpu_plugin_opset");
+
+    MoENode() = default;
+
+    struct Config {
+        bool quantized;
+        int experts;
+        int hidden_size;
+        int intermediate_size;
+    };
+
+    // args:
+    //      0: input          [tokens, hidden_size]
+    //      1: routing        [experts, tokens, 1]
+    //      2: gate_proj      [experts, intermediate_size, hidden_size]
+    //      3: up_proj        [experts, intermediate_size, hidden_size]
+    //      4: down_proj      [experts, hidden_size, intermediate_size]
+    //   quantized (int8 weights, f32 scales per output channel):
+    //      5: gate_scales    [experts, intermediate_size, 1]
+    //      6: up_scales      [experts, intermediate_size, 1]
+    //      7: down_scales    [experts, hidden_size, 1]
+    MoENode(const OutputVector& args, const Config& cfg) : Op(args), m_config(cfg) {
+        validate_and_infer_types();
+    }
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    const Config& get_config() const {
+        return m_config;
+    }
+
+private:
+    Config m_config{};
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,192 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "moe_fusion.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/swish.hpp"
+#include "openvino/op/tile.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "transformations/cpu_opset/x64/op/moe.hpp"
+#include "transformations/utils/gen_pattern.hpp"
+
+using namespace ov::gen_pattern;
+using namespace ov::pass;
+
+namespace {
+
+struct WeightPattern {
+    std::shared_ptr<ov::Node> weight;  // the constant in the original precision
+    std::shared_ptr<ov::Node> weight_i8;
+    std::shared_ptr<ov::Node> scales;
+    std::shared_ptr<ov::Node> pattern;
+};
+
+// f32 | f16/bf16 -> Convert | symmetrically quantized i8 -> Convert -> Multiply(scales per OC)
+WeightPattern makeWeightPattern() {
+    WeightPattern w;
+    w.weight = makePattern<ov::op::v0::Constant>({});
+    auto weight_cvt = makePattern<ov::op::v0::Convert>({w.weight}, {{"destination_type", "f32"}});
+    w.weight_i8 = makeConst(ov::element::i8, ov::PartialShape::dynamic(3), nullptr);
+    w.scales = makeConst(ov::element::f32, ov::PartialShape({ov::Dimension(), ov::Dimension(), 1}), nullptr);
+    auto weight_i8_f32 = makePattern<ov::op::v0::Convert>({w.weight_i8}, {{"destination_type", "f32"}});
+    auto weight_deq =
+        makePattern<ov::op::v1::Multiply>({weight_i8_f32, w.scales}, {{"auto_broadcast", "numpy"}});
+    w.pattern = weight_cvt | w.weight | weight_deq;
+    return w;
+}
+
+}  // namespace
+
+ov::intel_cpu::MoEFusion::MoEFusion() {
+    MATCHER_SCOPE(MoEFusion);
+
+    auto input = makePattern("[?,?]");
+    auto tiled = makePattern<op::v0::Tile>({input, makePattern<op::v0::Constant>({})});  // [experts * tokens, hidden]
+    auto expert_input = makePattern<op::v1::Reshape>({tiled, makePattern()});          // [experts, tokens, hidden]
+
+    auto gate_w = makeWeightPattern();
+    auto up_w = makeWeightPattern();
+    auto down_w = makeWeightPattern();
+
+    auto gate_proj = makePattern<op::v0::MatMul>({expert_input, gate_w.pattern},
+                                                 {{"transpose_a", false}, {"transpose_b", true}});
+    auto up_proj = makePattern<op::v0::MatMul>({expert_input, up_w.pattern},
+                                               {{"transpose_a", false}, {"transpose_b", true}});
+    auto silu_gate = makePattern<ov::op::v4::Swish>({gate_proj});
+    auto gated_up = makePattern<ov::op::v1::Multiply>({silu_gate, up_proj}, {{"auto_broadcast", "numpy"}});
+    auto down_proj = makePattern<op::v0::MatMul>({gated_up, down_w.pattern},
+                                                 {{"transpose_a", false}, {"transpose_b", true}});
+
+    auto routing = makePattern("[?,?,?]");
+    auto weighted = makePattern<ov::op::v1::Multiply>({down_proj, routing}, {{"auto_broadcast", "numpy"}});
+    auto reduce_axis = makePattern<op::v0::Constant>({});
+    auto result = makePattern<ov::op::v1::ReduceSum>({weighted, reduce_axis}, {{"keep_dims", false}});
+
+    matcher_pass_callback callback = [OV_CAPTURE_CPY_AND_THIS](ov::pass::pattern::Matcher& m) {
+        PatternValidator validator(m);
+        if (!validator) {
+            return false;
+        }
+
+        const auto& pattern_map = m.get_pattern_value_map();
+        auto root = m.get_match_root();
+        auto src = pattern_map.at(input);
+        if (!src.get_element_type().is_real()) {
+            return false;
+        }
+
+        // the results of the experts are summed up
+        const auto axis = ov::as_type_ptr<op::v0::Constant>(pattern_map.at(reduce_axis).get_node_shared_ptr());
+        if (!axis || axis->cast_vector<int64_t>() != std::vector<int64_t>{0}) {
+            return false;
+        }
+
+        // all 3 projections must be quantized at the same time
+        const bool quantized = pattern_map.count(gate_w.weight_i8) > 0;
+        for (const auto* w : {&gate_w, &up_w, &down_w}) {
+            if ((pattern_map.count(w->weight_i8) > 0) != quantized) {
+                return false;
+            }
+        }
+        auto weight = [&](const WeightPattern& w) {
+            return pattern_map.at(quantized ? w.weight_i8 : w.weight);
+        };
+        const auto gate_proj_w = weight(gate_w);
+        const auto up_proj_w = weight(up_w);
+        const auto down_proj_w = weight(down_w);
+
+        if (!gate_proj_w.get_partial_shape().is_static() || !down_proj_w.get_partial_shape().is_static()) {
+            return false;
+        }
+        const auto gate_shape = gate_proj_w.get_shape();  // [experts, intermediate_size, hidden_size]
+        const auto down_shape = down_proj_w.get_shape();  // [experts, hidden_size, intermediate_size]
+        if (gate_shape.size() != 3 || up_proj_w.get_partial_shape() != gate_proj_w.get_partial_shape() ||
+            down_shape != ov::Shape{gate_shape[0], gate_shape[2], gate_shape[1]}) {
+            return false;
+        }
+        const auto experts = gate_shape[0];
+        const auto intermediate_size = gate_shape[1];
+        const auto hidden_size = gate_shape[2];
+
+        // the hidden states of all the tokens are repeated for every expert
+        const auto tile = pattern_map.at(tiled).get_node_shared_ptr();
+        const auto repeats = ov::as_type_ptr<op::v0::Constant>(tile->get_input_node_shared_ptr(1));
+        if (!repeats || repeats->cast_vector<int64_t>() != std::vector<int64_t>{static_cast<int64_t>(experts), 1}) {
+            return false;
+        }
+        const auto& expert_input_shape = pattern_map.at(expert_input).get_partial_shape();
+        if (expert_input_shape.rank() != 3 || !expert_input_shape[0].compatible(experts) ||
+            !expert_input_shape[2].compatible(hidden_size) || !src.get_partial_shape()[1].compatible(hidden_size)) {
+            return false;
+        }
+
+        // the routing weights are applied per expert and token
+        const auto& routing_shape = pattern_map.at(routing).get_partial_shape();
+        if (!routing_shape[0].compatible(experts) || !routing_shape[2].compatible(1) ||
+            pattern_map.at(weighted).get_partial_shape().rank() != 3) {
+            return false;
+        }
+
+        // the kernel reads a scale per expert and output channel, the broadcast ones are not supported
+        if (quantized) {
+            const auto scales_match = [&](const WeightPattern& w, size_t channels) {
+                return pattern_map.at(w.scales).get_partial_shape() == ov::Shape{experts, channels, 1};
+            };
+            if (!scales_match(gate_w, intermediate_size) || !scales_match(up_w, intermediate_size) ||
+                !scales_match(down_w, hidden_size)) {
+                return false;
+            }
+        }
+
+        MoENode::Config config{};
+        config.quantized = quantized;
+        config.experts = static_cast<int>(experts);
+        config.hidden_size = static_cast<int>(hidden_size);
+        config.intermediate_size = static_cast<int>(intermediate_size);
+
+        OutputVector new_args{src, pattern_map.at(routing), gate_proj_w, up_proj_w, down_proj_w};
+        if (quantized) {
+            new_args.push_back(pattern_map.at(gate_w.scales));
+            new_args.push_back(pattern_map.at(up_w.scales));
+            new_args.push_back(pattern_map.at(down_w.scales));
+        }
+
+        auto new_node = std::make_shared<MoENode>(new_args, config);
+        new_node->set_friendly_name(root->get_friendly_name());
+        ov::copy_runtime_info({pattern_map.at(gate_proj).get_node_shared_ptr(),
+                               pattern_map.at(up_proj).get_node_shared_ptr(),
+                               pattern_map.at(down_proj).get_node_shared_ptr(),
+                               pattern_map.at(weighted).get_node_shared_ptr(),
+                               root},
+                              new_node);
+        // callback is for plugin implementation to check if it can be supported
+        if (!transformation_callback(new_node)) {
+            return false;
+        }
+
+        ov::replace_node(root, new_node);
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(result, matcher_name);
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,25 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/matcher_pass.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Fuses the Mixture of Experts block exported in the batched (dense) form, where the hidden states are tiled
+ * over all the experts, every expert MLP is computed by batched MatMuls and the results are weighted by the
+ * dense routing tensor and summed over the experts:
+ *
+ *   x[T, H] -> Tile[E, 1] -> Reshape[E, T, H] -> silu(x * gate^T) * (x * up^T) -> * down^T -> [E, T, H]
+ *                                                         -> Multiply(routing[E, T, 1]) -> ReduceSum(0) -> [T, H]
+ */
+class MoEFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("MoEFusion");
+    MoEFusion();
+};
+
+}  // namespace ov::intel_cpu
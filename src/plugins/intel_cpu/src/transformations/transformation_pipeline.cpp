@@ -28,6 +28,7 @@
 #include "openvino/core/node_output.hpp"
 #include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
+#include "openvino/core/shape.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/itt.hpp"
@@ -38,6 +39,7 @@
 #include "openvino/op/clamp.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/convert.hpp"
+#include "openvino/op/embedding_segments_sum.hpp"
 #include "openvino/op/fake_quantize.hpp"
 #include "openvino/op/gru_sequence.hpp"
 #include "openvino/op/lstm_sequence.hpp"
@@ -45,14 +47,18 @@
 #include "openvino/op/max_pool.hpp"
 #include "openvino/op/mish.hpp"
 #include "openvino/op/paged_attention.hpp"
+#include "openvino/op/parameter.hpp"
 #include "openvino/op/reduce_max.hpp"
 #include "openvino/op/reduce_sum.hpp"
 #include "openvino/op/reshape.hpp"
 #include "openvino/op/result.hpp"
+#include "openvino/op/select.hpp"
 #include "openvino/op/softmax.hpp"
 #include "openvino/op/swish.hpp"
 #include "openvino/op/transpose.hpp"
 #include "openvino/op/util/attr_types.hpp"
+#include "openvino/op/util/embeddingbag_offsets_base.hpp"
+#include "openvino/op/util/embeddingbag_packed_base.hpp"
 
 // Common transformations
 #include "openvino/pass/constant_folding.hpp"
@@ -148,6 +154,7 @@
 
 // CPU specific transformations
 #include "transformations/cpu_opset/common/pass/insert_convert_after_extension.hpp"
+#include "transformations/cpu_opset/common/pass/lm_head_sampling_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/ngram_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/permute_slice_n_interpolation.hpp"
 #include "transformations/cpu_opset/common/pass/stateful_sdpa_fusion.hpp"
@@ -167,6 +174,7 @@
 
 // Misc
 #include "nodes/fake_quantize.h"
+#include "nodes/lm_head_sampling.h"
 #include "nodes/mvn.h"
 #include "nodes/normalize.h"
 #include "nodes/paged_attn.h"
@@ -201,7 +209,6 @@
 #    include "openvino/op/prelu.hpp"
 #    include "openvino/op/relu.hpp"
 #    include "openvino/op/round.hpp"
-#    include "openvino/op/select.hpp"
 #    include "openvino/op/sigmoid.hpp"
 #    include "openvino/op/sqrt.hpp"
 #    include "openvino/op/tanh.hpp"
@@ -222,6 +229,7 @@
 #    include "low_precision/fuse_convert.hpp"
 #    include "low_precision/weightable_layer_transformation.hpp"
 #    include "nodes/llm_mlp.h"
+#    include "nodes/moe.h"
 #    include "nodes/qkv_proj.h"
 #    include "nodes/rms_norm.h"
 #    include "onednn/dnnl.h"
@@ -237,6 +245,7 @@
 #    include "transformations/cpu_opset/common/pass/decompose_rms_norm.hpp"
 #    include "transformations/cpu_opset/x64/pass/convert_to_interaction.hpp"
 #    include "transformations/cpu_opset/x64/pass/mlp_fusion.hpp"
+#    include "transformations/cpu_opset/x64/pass/moe_fusion.hpp"
 #    include "transformations/cpu_opset/x64/pass/qkv_proj_fusion.hpp"
 #    include "transformations/op_conversions/group_normalization_decomposition.hpp"
 #    include "transformations/op_conversions/hsigmoid_decomposition.hpp"
@@ -289,6 +298,47 @@ namespace ov::intel_cpu {
 
 using const_node_ptr = const std::shared_ptr<const ov::Node>;
 
+namespace {
+
+// The embedding bag nodes dequantize the compressed table rows while they are accumulated
+bool is_embedding_table(const ov::Input<ov::Node>& input) {
+    const auto* node = input.get_node();
+    return input.get_index() == 0 &&
+           (ov::is_type<ov::op::util::EmbeddingBagOffsetsBase>(node) ||
+            ov::is_type<ov::op::util::EmbeddingBagPackedBase>(node) ||
+            ov::is_type<ov::op::v3::EmbeddingSegmentsSum>(node));
+}
+
+// Select with a single element condition is kept as an exit point of the static graph if one of its branches
+// is computed only for it, so the graph can skip the branch that is not taken (see Graph::ResolveExitPoints)
+bool is_select_exit_point(const std::shared_ptr<const ov::Node>& n) {
+    if (!ov::is_type<const ov::op::v1::Select>(n)) {
+        return false;
+    }
+    const auto& condition = n->get_input_partial_shape(0);
+    if (!condition.is_static() || ov::shape_size(condition.to_shape()) != 1) {
+        return false;
+    }
+    for (size_t port = 1; port < 3; port++) {
+        const auto branch = n->get_input_node_shared_ptr(port);
+        if (ov::is_type_any_of<ov::op::v0::Constant, ov::op::v0::Parameter>(branch)) {
+            continue;
+        }
+        const auto& outputs = branch->outputs();
+        if (std::all_of(outputs.begin(), outputs.end(), [&](const ov::Output<ov::Node>& output) {
+                const auto targets = output.get_target_inputs();
+                return std::all_of(targets.begin(), targets.end(), [&](const ov::Input<ov::Node>& target) {
+                    return target.get_node() == n.get() && target.get_index() == port;
+                });
+            })) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
 bool Transformations::is_decompression_multiply(const_node_ptr& node) {
     auto all_has_type = [](const std::set<ov::Input<ov::Node>>& consumers, const ov::DiscreteTypeInfo& type) {
         return std::all_of(consumers.begin(), consumers.end(), [&type](const ov::Input<ov::Node>& input) {
@@ -300,6 +350,9 @@ bool Transformations::is_decompression_multiply(const_node_ptr& node) {
     if (all_has_type(consumers, ov::op::v0::MatMul::get_type_info_static())) {
         return true;
     }
+    if (!consumers.empty() && std::all_of(consumers.begin(), consumers.end(), is_embedding_table)) {
+        return true;
+    }
 
     auto are_converts_from_decompression = [&all_has_type](const std::set<ov::Input<ov::Node>>& consumers) {
         if (!all_has_type(consumers, ov::op::v0::Convert::get_type_info_static())) {
@@ -540,7 +593,7 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
         [](const_node_ptr& node) -> bool {
             const auto consumers = node->get_output_target_inputs(0);
             return std::all_of(consumers.begin(), consumers.end(), [](const ov::Input<ov::Node>& consumer) {
-                return !ov::is_type<ov::op::v0::MatMul>(consumer.get_node());
+                return !ov::is_type<ov::op::v0::MatMul>(consumer.get_node()) && !is_embedding_table(consumer);
             });
         },
         ov::pass::KeepConstAndDecompression);
@@ -1062,7 +1115,29 @@ void Transformations::PostLpt() {
     CPU_DISABLE_PASS_COMMON(postLPTPassManager, ov::pass::RoPEFusionChatGLMHF);
     CPU_REGISTER_PASS_X64(postLPTPassManager, CausalMaskPreprocessFusion);
 
+    // LM head fusion keeps the logits of the decoding step from being written and reread by TopK / Multinomial
+    if (config.enableLMHeadSamplingFusion) {
+        CPU_REGISTER_PASS_COMMON(postLPTPassManager, LMHeadSamplingFusion);
+        CPU_SET_CALLBACK_COMMON(
+            postLPTPassManager,
+            [](const_node_ptr& node) -> bool {
+                std::string errorMsg;
+                return node::LMHeadSampling::isSupportedOperation(node, errorMsg);
+            },
+            LMHeadSamplingFusion);
+    }
+
 #if defined(OPENVINO_ARCH_X86_64)
+    // MoE fusion computes only the experts which receive tokens, so it is beneficial regardless of the ISA
+    CPU_REGISTER_PASS_X64(postLPTPassManager, MoEFusion);
+    CPU_SET_CALLBACK_X64(
+        postLPTPassManager,
+        [](const_node_ptr& node) -> bool {
+            std::string errorMsg;
+            return node::MoE::isSupportedOperation(node, errorMsg);
+        },
+        MoEFusion);
+
     // MLP & QKV fusion optimizations is focused on throughput, only enabled on AMX-bf16 & LLM serving use cases.
     auto can_use_amx_bf16_int8 = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_amx) &&
                                  (config.inferencePrecision == element::bf16);
@@ -1315,7 +1390,8 @@ void Transformations::MainSnippets() {
     };
 #endif  // OPENVINO_ARCH_X86_64
 
-    auto is_supported_op = [](const std::shared_ptr<const ov::Node>& n) -> bool {
+    const bool keep_exit_points = config.enableEarlyExit;
+    auto is_supported_op = [keep_exit_points](const std::shared_ptr<const ov::Node>& n) -> bool {
 #if defined(OPENVINO_ARCH_ARM64)
         // Power on ARM64 only supports power and swish with scalar second inputs
         auto is_supported_with_scalar_inputs = [](const std::shared_ptr<const ov::Node>& n) {
@@ -1366,7 +1442,8 @@ void Transformations::MainSnippets() {
                                        ov::op::v1::LogicalNot,
                                        ov::op::v0::Xor>(n));
         };
-        return is_supported(n) || is_supported_with_scalar_inputs(n);
+        return (is_supported(n) || is_supported_with_scalar_inputs(n)) &&
+               !(keep_exit_points && is_select_exit_point(n));
 #else
         // CPU Plugin support Swish in Subgraph via conversion to SwichCPU which assumes second input to be constant,
         // and CPU Plugin does not support Mish for x64
@@ -1387,7 +1464,8 @@ void Transformations::MainSnippets() {
                                        const ov::op::v1::ReduceMax,
                                        const ov::op::v1::ReduceSum>(n));
         };
-        return !is_unsupported(n) && !is_unsupported_by_common_tokenization(n);
+        return !is_unsupported(n) && !is_unsupported_by_common_tokenization(n) &&
+               !(keep_exit_points && is_select_exit_point(n));
 #endif
     };
 
@@ -4,7 +4,9 @@
 
 #include "serialize.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <functional>
 #include <istream>
@@ -15,9 +17,13 @@
 #include <variant>
 
 #include "openvino/core/except.hpp"
+#include "openvino/core/graph_util.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/core/rt_info.hpp"
 #include "openvino/core/shape.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/serialize.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
@@ -40,7 +46,49 @@ ModelSerializer::ModelSerializer(std::ostream& ostream, const CacheEncrypt& encr
           encrypt_fn) {};
 
 void ModelSerializer::operator<<(const std::shared_ptr<ov::Model>& model) {
-    run_on_model(std::const_pointer_cast<ov::Model>(model->clone()));
+    auto cloned = std::const_pointer_cast<ov::Model>(model->clone());
+    flush_subnormals(cloned);
+    cloned->set_rt_info(true, weights_subnormals_flushed_key);
+    run_on_model(cloned);
+}
+
+void ModelSerializer::flush_subnormals(const std::shared_ptr<ov::Model>& model) {
+    // The CPU plugin treats f32 subnormals in the weights as zeros anyway, so they are flushed once on export
+    // instead of scanning all the weights on every import.
+    auto is_subnormal = [](uint32_t value) {
+        return (value & 0x7f800000) == 0 && (value & 0x007fffff) != 0;
+    };
+
+    for (const auto& node : model->get_ordered_ops()) {
+        // the import skips the scan for all the constants, including the ones of the bodies
+        if (const auto multi_subgraph = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(node)) {
+            for (const auto& body : multi_subgraph->get_functions()) {
+                flush_subnormals(body);
+            }
+            continue;
+        }
+
+        const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(node);
+        if (!constant || constant->get_element_type() != ov::element::f32) {
+            continue;
+        }
+
+        const auto* src = constant->get_data_ptr<uint32_t>();
+        const size_t size = shape_size(constant->get_shape());
+        if (std::none_of(src, src + size, is_subnormal)) {
+            continue;
+        }
+
+        // the data may be shared with the compiled model, so the flushed values go to a new constant
+        ov::Tensor data(ov::element::f32, constant->get_shape());
+        std::transform(src, src + size, static_cast<uint32_t*>(data.data()), [&](uint32_t value) {
+            return is_subnormal(value) ? value & 0x80000000 : value;
+        });
+        auto flushed = std::make_shared<ov::op::v0::Constant>(data);
+        flushed->set_friendly_name(constant->get_friendly_name());
+        ov::copy_runtime_info(constant, flushed);
+        ov::replace_node(constant, flushed);
+    }
 }
 
 bool ModelSerializer::use_absolute_offset() {
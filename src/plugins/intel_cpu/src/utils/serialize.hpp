@@ -10,6 +10,7 @@
 #include <pugixml.hpp>
 #include <string>
 #include <variant>
+#include <vector>
 
 #include "openvino/core/model.hpp"
 #include "openvino/pass/serialize.hpp"
@@ -18,6 +19,10 @@
 
 namespace ov::intel_cpu {
 
+// The model rt_info flag which is set on export when the serialized f32 constants have no subnormals.
+// The imported constants can be used as is then, without scanning them.
+inline const std::vector<std::string> weights_subnormals_flushed_key{"intel_cpu", "weights_subnormals_flushed"};
+
 class ModelSerializer : private ov::pass::StreamSerialize {
 public:
     using CacheEncrypt = std::function<std::string(const std::string&)>;
@@ -27,6 +32,8 @@ public:
     void operator<<(const std::shared_ptr<ov::Model>& model);
 
 private:
+    static void flush_subnormals(const std::shared_ptr<ov::Model>& model);
+
     bool use_absolute_offset() override;
 };
 
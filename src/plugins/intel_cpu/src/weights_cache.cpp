@@ -41,29 +41,29 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(const std::string
                                                                const std::function<MemoryPtr(void)>& create,
                                                                bool valid) {
     MemoryInfo::Ptr ptr;
-    MemoryPtr newPtr;
     {
         std::unique_lock<std::mutex> lock(guard);
         auto found = sharedWeights.find(key);
-
-        auto isCached = [&]() -> bool {
-            if (found == sharedWeights.end()) {
-                return false;
-            }
+        if (found != sharedWeights.end() && found->second) {
             ptr = found->second;
-            if (!ptr) {
-                return false;
-            }
-            newPtr = ptr->sharedMemory.lock();
-            return static_cast<bool>(newPtr);
-        };
-
-        if (!isCached()) {
-            newPtr = create();
-            ptr = std::make_shared<MemoryInfo>(newPtr, valid);
+        } else {
+            ptr = std::make_shared<MemoryInfo>(nullptr, valid);
             sharedWeights[key] = ptr;
         }
     }
+
+    MemoryPtr newPtr;
+    {
+        // only the users of the same key wait for the memory to be created
+        std::unique_lock<std::mutex> lock(ptr->createGuard);
+        newPtr = ptr->sharedMemory.lock();
+        if (!newPtr) {
+            newPtr = create();
+            ptr->sharedMemory = newPtr;
+            ptr->valid.store(valid, std::memory_order_release);
+        }
+    }
+
     return std::make_shared<SharedMemory>(ptr->valid.load(std::memory_order_relaxed)
                                               ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
                                               : std::unique_lock<std::mutex>(ptr->guard),
@@ -73,7 +73,6 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(const std::string
 
 WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) const {
     MemoryInfo::Ptr ptr;
-    MemoryPtr newPtr;
     {
         std::unique_lock<std::mutex> lock(guard);
         auto found = sharedWeights.find(key);
@@ -81,9 +80,15 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
         OPENVINO_ASSERT(found != sharedWeights.end(), "Unknown shared memory with key ", key);
         ptr = found->second;
         OPENVINO_ASSERT(ptr, "Unknown shared memory with key ", key);
+    }
+
+    MemoryPtr newPtr;
+    {
+        std::unique_lock<std::mutex> lock(ptr->createGuard);
         newPtr = ptr->sharedMemory.lock();
-        OPENVINO_ASSERT(newPtr, "Unknown shared memory with key ", key);
     }
+    OPENVINO_ASSERT(newPtr, "Unknown shared memory with key ", key);
+
     return std::make_shared<SharedMemory>(ptr->valid.load(std::memory_order_relaxed)
                                               ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
                                               : std::unique_lock<std::mutex>(ptr->guard),
@@ -117,6 +122,7 @@ WeightsSharing::Statistics WeightsSharing::dumpStatistics() const {
     std::lock_guard<std::mutex> lock(guard);
 
     for (const auto& item : sharedWeights) {
+        std::lock_guard<std::mutex> createLock(item.second->createGuard);
         auto memory = item.second->sharedMemory.lock();
         if (memory) {
             retVal.total_size += memory->getDesc().getCurrentMemSize();
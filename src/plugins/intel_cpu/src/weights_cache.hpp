@@ -37,6 +37,9 @@ class WeightsSharing {
         MemoryInfo(const MemoryPtr& memoryPtr, bool valid) : sharedMemory(memoryPtr), valid(valid) {}
 
         std::mutex guard;
+        // protects the creation of the memory, so the entries are created (e.g. the weights are repacked)
+        // concurrently without holding the lock of the whole cache
+        std::mutex createGuard;
         std::weak_ptr<IMemory> sharedMemory;
         std::atomic<bool> valid;
     };
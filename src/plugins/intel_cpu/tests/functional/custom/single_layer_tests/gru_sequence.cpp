@@ -383,6 +383,29 @@ INSTANTIATE_TEST_SUITE_P(nightly_dynamic_bf16,
                                             ::testing::Values(cpuParams),
                                             ::testing::Values(additionalConfig[1])),
                          GRUSequenceCPUTest::getTestCaseName);
+
+// small batches with a large hidden size run the fused sequence kernel, the batch 6 falls back to oneDNN
+const std::vector<InputShape> smallBatchLargeHidden = {
+    {{-1, -1, 16},                                                     // Dynamic shape 0
+     {{1, 3, 16}, {3, 2, 16}, {6, 2, 16}, {4, 4, 16}}},                // Target shapes
+    {{-1, 1, 272},                                                     // Dynamic shape 1
+     {{1, 1, 272}, {3, 1, 272}, {6, 1, 272}, {4, 1, 272}}},            // Target shapes
+    {{-1},                                                             // Dynamic shape 2
+     {{1}, {3}, {6}, {4}}}};                                           // Target shapes
+
+INSTANTIATE_TEST_SUITE_P(smoke_dynamic_SmallBatchLargeHidden,
+                         GRUSequenceCPUTest,
+                         ::testing::Combine(::testing::Values(smallBatchLargeHidden),
+                                            ::testing::ValuesIn(mode),
+                                            ::testing::ValuesIn(activations),
+                                            ::testing::ValuesIn(clip),
+                                            ::testing::ValuesIn(linearBeforeReset),
+                                            ::testing::Values(ov::op::RecurrentSequenceDirection::FORWARD,
+                                                              ov::op::RecurrentSequenceDirection::REVERSE),
+                                            ::testing::ValuesIn(netPrecisions),
+                                            ::testing::Values(cpuParams),
+                                            ::testing::Values(ov::AnyMap{})),
+                         GRUSequenceCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace test
 }  // namespace ov
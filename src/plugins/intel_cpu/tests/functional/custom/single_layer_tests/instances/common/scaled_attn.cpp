@@ -76,6 +76,36 @@ const std::vector<std::vector<InputShape>> shapes{
            {ov::Shape{16, 48},  ov::Shape{16, 1}, ov::Shape{1, 48}}}
         },
     },
+    // long context processed by blocks of keys, the last block is partial
+    {
+        // q shape
+        {ov::test::InputShape{ov::PartialShape{-1, 2, -1, 64},
+            {ov::Shape{1, 2, 600, 64}, ov::Shape{1, 2, 40, 64}}}
+        },
+        // kv shape
+        {ov::test::InputShape{ov::PartialShape{-1, 2, -1, 64},
+            {ov::Shape{1, 2, 1100, 64}, ov::Shape{1, 2, 1100, 64}}}
+        },
+        // attn shape
+        {ov::test::InputShape{ov::PartialShape{-1, 1, -1, -1},
+            {ov::Shape{1, 1, 600, 1100}, ov::Shape{1, 1, 40, 1100}}}
+        },
+    },
+    // long prompt attending to itself, the causal mask skips the blocks of keys past the boundary of the query block
+    {
+        // q shape
+        {ov::test::InputShape{ov::PartialShape{-1, 2, -1, 64},
+            {ov::Shape{1, 2, 1100, 64}}}
+        },
+        // kv shape
+        {ov::test::InputShape{ov::PartialShape{-1, 2, -1, 64},
+            {ov::Shape{1, 2, 1100, 64}}}
+        },
+        // attn shape
+        {ov::test::InputShape{ov::PartialShape{-1, 1, -1, -1},
+            {ov::Shape{1, 1, 1100, 1100}}}
+        },
+    },
 };
 
 const auto params = testing::Combine(testing::Values(ElementType::f32, ElementType::bf16),
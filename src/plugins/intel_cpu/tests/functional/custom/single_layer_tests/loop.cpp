@@ -385,6 +385,77 @@ protected:
     }
 };
 
+class LoopEarlyExitConcatLayerCPUTest : public LoopLayerCPUTest {
+    // i = 0
+    // for trip_count:
+    //   x = x + 10
+    //   i = i + 1
+    //   y = concat(y, x)  // concatenated slices along axis 1
+    //   if (i >= 3) break
+
+protected:
+    void SetUp() override {
+        InputLayerType trip_count_type;
+        int64_t trip_count;
+        bool exec_cond;
+        std::vector<InputShape> shapes;
+        std::vector<LOOP_IN_TYPE> types;
+        std::tie(trip_count_type, trip_count, exec_cond, shapes, types, inType) = this->GetParam();
+
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        init_input_shapes(shapes);
+
+        ov::ParameterVector params;
+        for (auto&& shape : inputDynamicShapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(inType, shape));
+        }
+        // Body parameters
+        ov::ParameterVector body_params = {std::make_shared<ov::op::v0::Parameter>(ov::element::i64, ov::Shape{1}),
+                                           std::make_shared<ov::op::v0::Parameter>(inType, ov::PartialShape::dynamic())};
+
+        auto exec_condition = std::make_shared<ov::op::v0::Constant>(ov::element::boolean, ov::Shape{1}, exec_cond);
+        std::shared_ptr<ov::Node> trip_count_input;
+        int shift = 0;
+        if (trip_count_type == InputLayerType::PARAMETER) {
+            for (auto& target : targetStaticShapes)
+                target.insert(target.begin(), ov::Shape{});
+            trip_count_input = std::make_shared<ov::op::v0::Parameter>(ov::element::i64, ov::Shape{1});
+            trip_count_input->set_friendly_name("trip_count");
+            params.insert(params.begin(), ov::as_type_ptr<ov::op::v0::Parameter>(trip_count_input));
+            shift++;
+        } else {
+            trip_count_input = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{1}, trip_count);
+        }
+
+        // Body
+        auto iter_step = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{1}, 1);
+        auto iter_limit = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{1}, 3);
+        auto iter_next = std::make_shared<ov::op::v1::Add>(body_params[0], iter_step);
+        auto body_condition = std::make_shared<ov::op::v1::Less>(iter_next, iter_limit);
+
+        auto constant = std::make_shared<ov::op::v0::Constant>(inType, std::vector<size_t>{1}, std::vector<float>{10});
+        auto add = std::make_shared<ov::op::v1::Add>(body_params[1], constant);
+
+        auto body = std::make_shared<ov::Model>(ov::OutputVector{body_condition, iter_next, add}, body_params);
+
+        auto loop = std::make_shared<ov::op::v5::Loop>(trip_count_input, exec_condition);
+        loop->set_function(body);
+        loop->set_special_body_ports(ov::op::v5::Loop::SpecialBodyPorts{-1, 0});
+
+        auto iter_init = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{1}, 0);
+        loop->set_merged_input(body_params[0], iter_init, iter_next);
+        loop->set_merged_input(body_params[1], params[shift], add);
+
+        auto out0 = loop->get_iter_value(add, -1);
+        // start=0, stride=1, part_size=1, end=-1, axis=1
+        auto out1 = loop->get_concatenated_slices(add, 0, 1, 1, -1, 1);
+
+        auto result0 = std::make_shared<ov::op::v0::Result>(out0);
+        auto result1 = std::make_shared<ov::op::v0::Result>(out1);
+        function = std::make_shared<ov::Model>(ov::ResultVector{result0, result1}, params, "loop");
+    }
+};
+
 class StaticLoopDynamicSubgraphCPUTest : public SubgraphBaseTest {
     void SetUp() override {
         InputShape input_shape = {{25, 1, 1}, {{25, 1, 1}, {25, 1, 1}}};  // infer more than once
@@ -464,6 +535,10 @@ TEST_P(LoopForConcatLayerCPUTest, CompareWithRefs) {
     run();
 }
 
+TEST_P(LoopEarlyExitConcatLayerCPUTest, CompareWithRefs) {
+    run();
+}
+
 TEST_F(StaticLoopDynamicSubgraphCPUTest, smoke_StaticLoopWithDynSubgraph) {
     run();
 }
@@ -681,6 +756,32 @@ INSTANTIATE_TEST_SUITE_P(smoke_LoopForConcat, LoopForConcatLayerCPUTest,
                                  ::testing::ValuesIn(inputPrecisions)),
                          LoopLayerCPUTest::getTestCaseName);
 
+// dim[axis] = 1 because loop supports concatenation only with stride = part_size = 1
+std::vector<std::vector<InputShape>> inputs_5 = {
+        {  // first test suit
+            {
+                {-1, 1, -1},
+                { // target static shapes
+                    {1, 1, 10},
+                    {4, 1, 3},
+                    {4, 1, 3},
+                    {1, 1, 1},
+                }
+            },
+        },
+};
+
+// the body exits after 3 iterations, so the trip count is either reached or not
+INSTANTIATE_TEST_SUITE_P(smoke_LoopEarlyExitConcat, LoopEarlyExitConcatLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(trip_count_type),
+                                 ::testing::Values(2, 3, 10),
+                                 ::testing::Values(true),
+                                 ::testing::ValuesIn(inputs_5),
+                                 ::testing::Values(std::vector<LOOP_IN_TYPE>{}),
+                                 ::testing::ValuesIn(inputPrecisions)),
+                         LoopLayerCPUTest::getTestCaseName);
+
 }  // namespace
 }  // namespace test
 }  // namespace ov
@@ -252,6 +252,30 @@ INSTANTIATE_TEST_SUITE_P(smoke_static_BatchSizeOne, LSTMSequenceCPUTest,
                                    ::testing::Values(ov::AnyMap{})),
                 LSTMSequenceCPUTest::getTestCaseName);
 
+// small batches with a large hidden size run the fused sequence kernel
+const std::vector<std::vector<InputShape>> smallBatchLargeHidden = {
+    { { {}, { {2, 5, 24} } },  // Static shapes
+      { {}, { {2, 1, 264} } },
+      { {}, { {2, 1, 264} } },
+      { {}, { {2} } } },
+    { { {}, { {4, 3, 24} } },  // Static shapes
+      { {}, { {4, 1, 256} } },
+      { {}, { {4, 1, 256} } },
+      { {}, { {4} } } },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_static_SmallBatchLargeHidden, LSTMSequenceCPUTest,
+                ::testing::Combine(::testing::ValuesIn(smallBatchLargeHidden),
+                                   ::testing::ValuesIn(mode),
+                                   ::testing::ValuesIn(activations),
+                                   ::testing::ValuesIn(clip),
+                                   ::testing::Values(ov::op::RecurrentSequenceDirection::FORWARD,
+                                                     ov::op::RecurrentSequenceDirection::REVERSE),
+                                   ::testing::ValuesIn(netPrecisions),
+                                   ::testing::Values(cpuParams),
+                                   ::testing::Values(ov::AnyMap{})),
+                LSTMSequenceCPUTest::getTestCaseName);
+
 INSTANTIATE_TEST_SUITE_P(nightly_static_bf16, LSTMSequenceCPUTest,
                 ::testing::Combine(::testing::ValuesIn(std::vector<std::vector<InputShape>>{staticShapes[0]}),
                                    ::testing::ValuesIn(mode),
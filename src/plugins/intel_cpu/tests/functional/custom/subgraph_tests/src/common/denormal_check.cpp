@@ -6,6 +6,7 @@
 #include "common_test_utils/data_utils.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/op/concat.hpp"
+#include "openvino/op/if.hpp"
 
 namespace ov {
 namespace test {
@@ -14,10 +15,7 @@ class DenormalNullifyCheck : public SubgraphBaseTest {
 protected:
 std::unique_ptr<ov::AlignedBuffer> pConstStorage;
 
-void validate() override {
-    const auto& actualOutputs = get_plugin_outputs();
-    ASSERT_FALSE(actualOutputs.empty());
-    auto& outTensor = actualOutputs.front();
+static void checkNoDenormals(const ov::Tensor& outTensor) {
     ASSERT_EQ(ov::element::f32, outTensor.get_element_type()) << "Unexpected element type";
     const float* data = reinterpret_cast<const float*>(outTensor.data());
     bool hasDenormals = false;
@@ -30,6 +28,26 @@ void validate() override {
     ASSERT_FALSE(hasDenormals);
 }
 
+// every third element of the constant is a denormal, the other ones are random normal values
+void fillWithDenormals() {
+    const size_t elemsCount = pConstStorage->size() / sizeof(float);
+    auto randomRange = ov::test::utils::generateVector<ov::element::f32>(elemsCount, 10, -10);
+    for (size_t i = 0; i < elemsCount; ++i) {
+        if (i % 3 == 0) {
+            const uint32_t denormal = 0x00000001u + static_cast<uint32_t>(i);
+            memcpy(&pConstStorage->get_ptr<float>()[i], &denormal, sizeof(float));
+        } else {
+            pConstStorage->get_ptr<float>()[i] = randomRange[i];
+        }
+    }
+}
+
+void validate() override {
+    const auto& actualOutputs = get_plugin_outputs();
+    ASSERT_FALSE(actualOutputs.empty());
+    checkNoDenormals(actualOutputs.front());
+}
+
 
 void SetUp() override {
     constexpr size_t alignment = 64; // bytes cache line size, to avoid denormals zeroing due to memory reallocation in the input node implementation
@@ -86,5 +104,64 @@ TEST_F(DenormalNullifyCheck, smoke_CPU_Denormal_Check) {
     }
 }
 
+// The subnormals are flushed on export, so the imported model must produce the same results without them
+TEST_F(DenormalNullifyCheck, smoke_CPU_Denormal_Check_ExportImport) {
+    fillWithDenormals();
+
+    compile_model();
+    std::stringstream stream;
+    compiledModel.export_model(stream);
+    auto importedModel = core->import_model(stream, targetDevice, configuration);
+
+    auto inferRequest = importedModel.create_infer_request();
+    auto input = inferRequest.get_input_tensor();
+    std::fill_n(input.data<float>(), input.get_size(), 1.f);
+    inferRequest.infer();
+    checkNoDenormals(inferRequest.get_output_tensor());
+}
+
+// The constants of the subgraph bodies are flushed as well, since the imported model skips the scan for all of them
+TEST_F(DenormalNullifyCheck, smoke_CPU_Denormal_Check_ExportImport_IfBody) {
+    fillWithDenormals();
+
+    const auto rtPrc = ov::element::f32;
+    const ov::Shape inpShape = {1, 24, 3, 3};
+    auto makeBody = [&](bool withConst) {
+        auto bodyParam = std::make_shared<ov::op::v0::Parameter>(rtPrc, inpShape);
+        std::shared_ptr<ov::Node> other = bodyParam;
+        if (withConst) {
+            other = std::make_shared<ov::op::v0::Constant>(ov::Tensor(rtPrc, inpShape, pConstStorage->get_ptr()));
+        }
+        auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{bodyParam, other}, 1);
+        auto result = std::make_shared<ov::op::v0::Result>(concat);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{bodyParam});
+    };
+
+    auto param = std::make_shared<ov::op::v0::Parameter>(rtPrc, inpShape);
+    auto cond = std::make_shared<ov::op::v0::Parameter>(ov::element::boolean, ov::Shape{1});
+    auto thenBody = makeBody(true);
+    auto elseBody = makeBody(false);
+    auto ifOp = std::make_shared<ov::op::v8::If>(cond);
+    ifOp->set_then_body(thenBody);
+    ifOp->set_else_body(elseBody);
+    ifOp->set_input(param, thenBody->get_parameters()[0], elseBody->get_parameters()[0]);
+    auto ifResult = ifOp->set_output(thenBody->get_results()[0], elseBody->get_results()[0]);
+    function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(ifResult)},
+                                           ov::ParameterVector{param, cond},
+                                           "denormal_check_if_body");
+
+    compile_model();
+    std::stringstream stream;
+    compiledModel.export_model(stream);
+    auto importedModel = core->import_model(stream, targetDevice, configuration);
+
+    auto inferRequest = importedModel.create_infer_request();
+    auto input = inferRequest.get_input_tensor(0);
+    std::fill_n(input.data<float>(), input.get_size(), 1.f);
+    inferRequest.get_input_tensor(1).data<bool>()[0] = true;
+    inferRequest.infer();
+    checkNoDenormals(inferRequest.get_output_tensor());
+}
+
 }  // namespace test
 }  // namespace ov
@@ -0,0 +1,160 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+#include <string>
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/greater.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/reduce_max.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/select.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+
+/*This test covers the early exit in the static graph: the Select with a single element condition
+ * evaluates the condition as soon as it is computed and skips the nodes which feed only the branch
+ * that is not taken. The early exit is enabled by the EARLY_EXIT property. The test checks the outputs and
+ * the profiling counters of the runtime model.
+
+                  Param
+                    |
+                  Relu
+            /       |        \
+     ReduceMax      |         Add (late_block)
+         |          |          |
+      Greater   Multiply    Multiply
+         |      (early_head)   |
+          \         |         /
+                 Select
+                   |
+                 Result
+*/
+
+namespace CPUSubgraphTestsDefinitions {
+
+class EarlyExit : public ov::test::SubgraphBaseTest {
+public:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert(ov::enable_profiling(true));
+        configuration.insert(ov::intel_cpu::snippets_mode(ov::intel_cpu::SnippetsMode::DISABLE));
+        configuration.insert(ov::intel_cpu::early_exit(true));
+        const auto precision = ov::element::f32;
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, shape);
+        auto relu = std::make_shared<ov::op::v0::Relu>(param);
+
+        auto axes = ov::op::v0::Constant::create(ov::element::i64, {2}, {0, 1});
+        auto score = std::make_shared<ov::op::v1::ReduceMax>(relu, axes, false);
+        auto confident =
+            std::make_shared<ov::op::v1::Greater>(score, ov::op::v0::Constant::create(precision, {}, {10.f}));
+        confident->set_friendly_name("condition");
+
+        auto early = std::make_shared<ov::op::v1::Multiply>(relu, ov::op::v0::Constant::create(precision, {1}, {2.f}));
+        early->set_friendly_name("early_head");
+        auto late = std::make_shared<ov::op::v1::Add>(relu, ov::op::v0::Constant::create(precision, {1}, {1.f}));
+        late->set_friendly_name("late_block");
+        auto lateHead =
+            std::make_shared<ov::op::v1::Multiply>(late, ov::op::v0::Constant::create(precision, {1}, {3.f}));
+
+        auto select = std::make_shared<ov::op::v1::Select>(confident, early, lateHead);
+        function = std::make_shared<ov::Model>(ov::OutputVector{select}, ov::ParameterVector{param});
+    }
+
+protected:
+    float infer(ov::InferRequest& request, float value) {
+        ov::Tensor input(ov::element::f32, shape);
+        std::fill_n(input.data<float>(), input.get_size(), value);
+        request.set_input_tensor(input);
+        request.infer();
+
+        const auto output = request.get_output_tensor();
+        const auto* data = output.data<const float>();
+        for (size_t i = 1; i < output.get_size(); ++i) {
+            EXPECT_EQ(data[i], data[0]) << "at index " << i;
+        }
+        return data[0];
+    }
+
+    struct LayerInfo {
+        int execOrder;
+        bool executed;
+    };
+
+    // the runtime layer which the original node is executed by, it may be fused into another one
+    LayerInfo layerInfo(const std::string& name) const {
+        for (const auto& op : compiledModel.get_runtime_model()->get_ops()) {
+            const auto& rtInfo = op->get_rt_info();
+            std::stringstream originalNames(rtInfo.at(ov::exec_model_info::ORIGINAL_NAMES).as<std::string>());
+            std::string originalName;
+            while (std::getline(originalNames, originalName, ',')) {
+                if (originalName == name) {
+                    return {std::stoi(rtInfo.at(ov::exec_model_info::EXECUTION_ORDER).as<std::string>()),
+                            rtInfo.at(ov::exec_model_info::PERF_COUNTER).as<std::string>() != "not_executed"};
+                }
+            }
+        }
+        ADD_FAILURE() << "Cannot find the layer " << name;
+        return {-1, false};
+    }
+
+    // the profiling counters are accumulated, so the branches are checked after all the inferences which take
+    // the same branch: the nodes of the other branch are executed after the condition and are never run
+    void checkSkipped(const std::string& taken, const std::string& skipped) const {
+        const auto condition = layerInfo("condition");
+        ASSERT_TRUE(layerInfo(taken).executed) << taken;
+        const auto info = layerInfo(skipped);
+        ASSERT_GT(info.execOrder, condition.execOrder) << skipped << " is executed before the condition";
+        ASSERT_FALSE(info.executed) << skipped;
+    }
+
+    const ov::Shape shape = {1, 16};
+};
+
+TEST_F(EarlyExit, smoke_EarlyExitSkipLateBlock) {
+    compile_model();
+    auto request = compiledModel.create_infer_request();
+
+    ASSERT_EQ(infer(request, 20.f), 40.f);
+    ASSERT_EQ(infer(request, 11.f), 22.f);
+    checkSkipped("early_head", "late_block");
+}
+
+TEST_F(EarlyExit, smoke_EarlyExitSkipEarlyHead) {
+    compile_model();
+    auto request = compiledModel.create_infer_request();
+
+    ASSERT_EQ(infer(request, 3.f), 12.f);
+    ASSERT_EQ(infer(request, -5.f), 3.f);
+    checkSkipped("late_block", "early_head");
+}
+
+TEST_F(EarlyExit, smoke_EarlyExitSwitchBranches) {
+    compile_model();
+    auto request = compiledModel.create_infer_request();
+
+    ASSERT_EQ(infer(request, 20.f), 40.f);
+    ASSERT_EQ(infer(request, 3.f), 12.f);
+    ASSERT_EQ(infer(request, -5.f), 3.f);
+    ASSERT_EQ(infer(request, 11.f), 22.f);
+    ASSERT_EQ(infer(request, 1.f), 6.f);
+    ASSERT_TRUE(layerInfo("early_head").executed);
+    ASSERT_TRUE(layerInfo("late_block").executed);
+}
+
+TEST_F(EarlyExit, smoke_EarlyExitDisabledByDefault) {
+    configuration.erase(ov::intel_cpu::early_exit.name());
+    compile_model();
+    auto request = compiledModel.create_infer_request();
+
+    ASSERT_EQ(infer(request, 20.f), 40.f);
+    ASSERT_EQ(infer(request, 11.f), 22.f);
+    ASSERT_TRUE(layerInfo("early_head").executed);
+    ASSERT_TRUE(layerInfo("late_block").executed);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/node_builders/constant.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/matmul.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test covers the FullyConnected executor tuning: the suitable implementations are benchmarked for every new
+ * shape bucket and the fastest one is stored in the database. The same file is used by the second compilation,
+ * which picks the stored implementations without benchmarking. The results must match the reference in both cases.
+
+    Param [?, 64]   Constant [64, 32]
+            \          /
+              MatMul
+                |
+              Result
+*/
+
+namespace ov {
+namespace test {
+
+class ExecutorTuningDbTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        dbPath = ov::test::utils::generateTestFilePrefix() + "_executor_tuning.db";
+        configuration.insert({ov::intel_cpu::executor_tuning_db.name(), dbPath});
+        configuration.insert({ov::hint::inference_precision.name(), ov::element::f32});
+
+        // the shapes of the same bucket reuse the tuned implementation
+        const InputShape inputShape{ov::PartialShape{-1, 64},
+                                    {ov::Shape{1, 64}, ov::Shape{7, 64}, ov::Shape{8, 64}, ov::Shape{1, 64}}};
+        init_input_shapes({inputShape});
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0]);
+        auto weights = ov::test::utils::make_constant(ov::element::f32, ov::Shape{64, 32});
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(param, weights);
+        function = std::make_shared<ov::Model>(ov::OutputVector{matMul}, ov::ParameterVector{param});
+    }
+
+    void TearDown() override {
+        ov::test::utils::removeFile(dbPath);
+        SubgraphBaseTest::TearDown();
+    }
+
+    std::string dbPath;
+};
+
+TEST_F(ExecutorTuningDbTest, smoke_FullyConnectedExecutorTuning) {
+    // the first run tunes the implementations, the second one reads them from the database
+    run();
+    run();
+}
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,125 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/if.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/relu.hpp"
+
+/*This test covers the If node whose ports share the memory with its bodies.
+ * The If inputs are produced by the Add nodes, so they can be passed to the bodies without copying,
+ * while the bodies modify them in place (Relu) or just forward them to the outputs.
+ * The second If output is also consumed by an extra node of the outer graph.
+
+    Param0   Param1
+      |        |
+     Add      Add
+       \      /
+        \    /
+          If
+        /    \
+   Result    +---------+
+             |         |
+           Result   Multiply
+                       |
+                     Result
+*/
+
+namespace ov {
+namespace test {
+
+using IfPortBindingParams = std::tuple<InputShape,  // input shape
+                                       bool>;       // condition
+
+class IfPortBindingCPUTest : public testing::WithParamInterface<IfPortBindingParams>,
+                             virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<IfPortBindingParams>& obj) {
+        InputShape inputShape;
+        bool condition;
+        std::tie(inputShape, condition) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::partialShape2str({inputShape.first}) << "_";
+        result << "TS=";
+        for (const auto& shape : inputShape.second) {
+            result << ov::test::utils::vec2str(shape) << "_";
+        }
+        result << "condition=" << condition;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        InputShape inputShape;
+        bool condition;
+        std::tie(inputShape, condition) = this->GetParam();
+
+        init_input_shapes({inputShape, inputShape});
+        const auto precision = ov::element::f32;
+
+        ov::ParameterVector params;
+        for (auto&& shape : inputDynamicShapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(precision, shape));
+        }
+
+        const auto one = ov::op::v0::Constant::create(precision, {1}, {1.f});
+        const auto add0 = std::make_shared<ov::op::v1::Add>(params[0], one);
+        const auto add1 = std::make_shared<ov::op::v1::Add>(params[1], one);
+
+        // then body: modifies the first input in place and forwards the second one
+        const auto thenParam0 = std::make_shared<ov::op::v0::Parameter>(precision, ov::PartialShape::dynamic());
+        const auto thenParam1 = std::make_shared<ov::op::v0::Parameter>(precision, ov::PartialShape::dynamic());
+        const auto thenRelu = std::make_shared<ov::op::v0::Relu>(thenParam0);
+        const auto thenResult0 = std::make_shared<ov::op::v0::Result>(thenRelu);
+        const auto thenResult1 = std::make_shared<ov::op::v0::Result>(thenParam1);
+        const auto thenBody = std::make_shared<ov::Model>(ov::ResultVector{thenResult0, thenResult1},
+                                                          ov::ParameterVector{thenParam0, thenParam1});
+
+        // else body: a single tensor goes to both outputs
+        const auto elseParam0 = std::make_shared<ov::op::v0::Parameter>(precision, ov::PartialShape::dynamic());
+        const auto elseParam1 = std::make_shared<ov::op::v0::Parameter>(precision, ov::PartialShape::dynamic());
+        const auto elseAdd = std::make_shared<ov::op::v1::Add>(elseParam0, elseParam1);
+        const auto elseResult0 = std::make_shared<ov::op::v0::Result>(elseAdd);
+        const auto elseResult1 = std::make_shared<ov::op::v0::Result>(elseAdd);
+        const auto elseBody = std::make_shared<ov::Model>(ov::ResultVector{elseResult0, elseResult1},
+                                                          ov::ParameterVector{elseParam0, elseParam1});
+
+        const auto cond = ov::op::v0::Constant::create(ov::element::boolean, {1}, {condition});
+        const auto ifOp = std::make_shared<ov::op::v8::If>(cond);
+        ifOp->set_then_body(thenBody);
+        ifOp->set_else_body(elseBody);
+        ifOp->set_input(add0, thenParam0, elseParam0);
+        ifOp->set_input(add1, thenParam1, elseParam1);
+        const auto out0 = ifOp->set_output(thenResult0, elseResult0);
+        const auto out1 = ifOp->set_output(thenResult1, elseResult1);
+
+        const auto two = ov::op::v0::Constant::create(precision, {1}, {2.f});
+        const auto multiply = std::make_shared<ov::op::v1::Multiply>(out1, two);
+
+        function = std::make_shared<ov::Model>(ov::OutputVector{out0, out1, multiply}, params, "IfPortBinding");
+    }
+};
+
+TEST_P(IfPortBindingCPUTest, CompareWithRefs) {
+    run();
+}
+
+namespace {
+
+const std::vector<InputShape> inputShapes = {
+    {{}, {{2, 5, 7}}},
+    {{-1, -1, 7}, {{2, 5, 7}, {1, 1, 7}, {4, 3, 7}, {2, 5, 7}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_IfPortBinding,
+                         IfPortBindingCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes), ::testing::Values(true, false)),
+                         IfPortBindingCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
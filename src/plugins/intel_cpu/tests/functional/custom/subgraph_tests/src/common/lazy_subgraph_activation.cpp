@@ -0,0 +1,95 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/if.hpp"
+#include "openvino/op/multiply.hpp"
+
+/*This test covers the lazy activation of the If bodies: the primitives of a body are created and
+ * its constants are executed only when the branch is taken for the first time.
+ * The branches are switched between the inferences, so each body is activated in the middle of the
+ * compiled model lifetime and has to be reused afterwards.
+
+    Param(cond)   Param
+        \          |
+         \         |
+          \        |
+           If (then: x * 2, else: x + 10)
+                   |
+                 Result
+*/
+
+namespace CPUSubgraphTestsDefinitions {
+
+class LazySubgraphActivation : public ov::test::SubgraphBaseTest {
+public:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({ov::intel_cpu::lazy_subgraph_activation.name(), true});
+        const auto precision = ov::element::f32;
+
+        auto cond = std::make_shared<ov::op::v0::Parameter>(ov::element::boolean, ov::Shape{1});
+        auto data = std::make_shared<ov::op::v0::Parameter>(precision, shape);
+
+        const auto thenParam = std::make_shared<ov::op::v0::Parameter>(precision, shape);
+        const auto thenMul =
+            std::make_shared<ov::op::v1::Multiply>(thenParam, ov::op::v0::Constant::create(precision, {1}, {2.f}));
+        const auto thenResult = std::make_shared<ov::op::v0::Result>(thenMul);
+        const auto thenBody = std::make_shared<ov::Model>(ov::ResultVector{thenResult}, ov::ParameterVector{thenParam});
+
+        const auto elseParam = std::make_shared<ov::op::v0::Parameter>(precision, shape);
+        const auto elseAdd =
+            std::make_shared<ov::op::v1::Add>(elseParam, ov::op::v0::Constant::create(precision, {1}, {10.f}));
+        const auto elseResult = std::make_shared<ov::op::v0::Result>(elseAdd);
+        const auto elseBody = std::make_shared<ov::Model>(ov::ResultVector{elseResult}, ov::ParameterVector{elseParam});
+
+        const auto ifOp = std::make_shared<ov::op::v8::If>(cond);
+        ifOp->set_then_body(thenBody);
+        ifOp->set_else_body(elseBody);
+        ifOp->set_input(data, thenParam, elseParam);
+        const auto out = ifOp->set_output(thenResult, elseResult);
+
+        function = std::make_shared<ov::Model>(ov::OutputVector{out}, ov::ParameterVector{cond, data});
+    }
+
+protected:
+    float infer(ov::InferRequest& request, bool condition, float value) {
+        ov::Tensor cond(ov::element::boolean, ov::Shape{1});
+        cond.data<bool>()[0] = condition;
+        ov::Tensor input(ov::element::f32, shape);
+        std::fill_n(input.data<float>(), input.get_size(), value);
+        request.set_input_tensor(0, cond);
+        request.set_input_tensor(1, input);
+        request.infer();
+
+        const auto output = request.get_output_tensor();
+        const auto* data = output.data<const float>();
+        for (size_t i = 1; i < output.get_size(); ++i) {
+            EXPECT_EQ(data[i], data[0]) << "at index " << i;
+        }
+        return data[0];
+    }
+
+    const ov::Shape shape = {2, 8};
+};
+
+TEST_F(LazySubgraphActivation, smoke_LazySubgraphActivationSwitchBranches) {
+    compile_model();
+    auto request = compiledModel.create_infer_request();
+
+    ASSERT_EQ(infer(request, true, 3.f), 6.f);
+    ASSERT_EQ(infer(request, true, 4.f), 8.f);
+    ASSERT_EQ(infer(request, false, 3.f), 13.f);
+    ASSERT_EQ(infer(request, true, 5.f), 10.f);
+    ASSERT_EQ(infer(request, false, 5.f), 15.f);
+
+    // the bodies are shared by the requests of the same stream
+    auto another = compiledModel.create_infer_request();
+    ASSERT_EQ(infer(another, false, 1.f), 11.f);
+    ASSERT_EQ(infer(another, true, 1.f), 2.f);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,274 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "internal_properties.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multinomial.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/topk.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test covers the fusion of the vocabulary projection with the token selection at the end of the decoding step.
+ * The reference Multinomial generates the random numbers differently from the CPU one, so the tokens are compared
+ * with the host computation which draws them the same way as the CPU Multinomial.
+
+      Param [B, H]
+          |
+   MatMul(weight^T)  -------------------------------- Result (logits, optional)
+          |
+   Divide(temperature)
+          |
+   greedy: TopK(1).indices
+   top-k:  TopK(k) -> Softmax(values) -> Multinomial -> Gather(indices)
+   all:    Softmax -> Multinomial
+          |
+        Result
+*/
+
+namespace ov {
+namespace test {
+
+enum class SamplingMode { Greedy, TopK, All };
+
+struct LMHeadSamplingParams {
+    SamplingMode mode;
+    bool quantized;
+    bool with_logits;
+    std::string sort = "value";  // the candidates order of the top-k sampling, only "value" is fused
+    bool enabled = true;         // the fusion is off unless LM_HEAD_SAMPLING_FUSION is set
+};
+
+class LMHeadSamplingTest : public testing::WithParamInterface<LMHeadSamplingParams>,
+                           public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<LMHeadSamplingParams>& obj) {
+        const auto& p = obj.param;
+        std::ostringstream result;
+        const char* mode = p.mode == SamplingMode::Greedy ? "greedy" : p.mode == SamplingMode::TopK ? "topk" : "all";
+        result << "mode=" << mode;
+        result << "_quantized=" << p.quantized << "_logits=" << p.with_logits;
+        if (p.mode == SamplingMode::TopK) {
+            result << "_sort=" << p.sort;
+        }
+        result << "_enabled=" << p.enabled;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        const auto& p = GetParam();
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration[ov::hint::inference_precision.name()] = ov::element::f32;
+        if (p.enabled) {
+            configuration[ov::intel_cpu::lm_head_sampling_fusion.name()] = true;
+        }
+
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+        weights.resize(V * H);
+        for (auto& w : weights) {
+            w = dist(gen);
+        }
+
+        auto hidden = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, H});
+        std::shared_ptr<ov::Node> weight;
+        if (p.quantized) {
+            std::vector<int8_t> weights_i8(V * H);
+            std::vector<float> scales(V);
+            for (size_t v = 0; v < V; v++) {
+                scales[v] = 0.01f + 0.01f * std::fabs(dist(gen));
+                for (size_t h = 0; h < H; h++) {
+                    weights_i8[v * H + h] = static_cast<int8_t>(std::lround(weights[v * H + h] * 127.0f));
+                    weights[v * H + h] = weights_i8[v * H + h] * scales[v];
+                }
+            }
+            auto weight_i8 = ov::op::v0::Constant::create(ov::element::i8, ov::Shape{V, H}, weights_i8);
+            auto weight_f32 = std::make_shared<ov::op::v0::Convert>(weight_i8, ov::element::f32);
+            auto weight_scales = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{V, 1}, scales);
+            weight = std::make_shared<ov::op::v1::Multiply>(weight_f32, weight_scales);
+        } else {
+            weight = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{V, H}, weights);
+        }
+        auto logits = std::make_shared<ov::op::v0::MatMul>(hidden, weight, false, true);
+        auto scores = std::make_shared<ov::op::v1::Divide>(
+            logits,
+            ov::op::v0::Constant::create(ov::element::f32, ov::Shape{}, {temperature}));
+
+        auto axis = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {1});
+        auto num_samples = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {1});
+        ov::Output<ov::Node> token;
+        if (p.mode == SamplingMode::Greedy) {
+            auto k = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {1});
+            auto topk = std::make_shared<ov::op::v11::TopK>(logits, k, -1, "max", "value", ov::element::i64);
+            token = topk->output(1);
+        } else if (p.mode == SamplingMode::TopK) {
+            auto k = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {top_k});
+            auto topk = std::make_shared<ov::op::v11::TopK>(scores, k, -1, "max", p.sort, ov::element::i32);
+            auto probs = std::make_shared<ov::op::v8::Softmax>(topk->output(0), -1);
+            auto sample =
+                std::make_shared<ov::op::v13::Multinomial>(probs, num_samples, ov::element::i32, true, false, 7, 11);
+            token = std::make_shared<ov::op::v8::Gather>(topk->output(1), sample, axis, 1);
+        } else {
+            auto probs = std::make_shared<ov::op::v8::Softmax>(scores, -1);
+            token =
+                std::make_shared<ov::op::v13::Multinomial>(probs, num_samples, ov::element::i32, true, false, 7, 11);
+        }
+
+        ov::ResultVector results{std::make_shared<ov::op::v0::Result>(token)};
+        if (p.with_logits) {
+            results.push_back(std::make_shared<ov::op::v0::Result>(logits));
+        }
+        function = std::make_shared<ov::Model>(results, ov::ParameterVector{hidden}, "LMHeadSampling");
+    }
+
+    // the host reference of the tokens, the random numbers are drawn the same way as by the CPU Multinomial
+    std::vector<int64_t> expected_tokens(const std::vector<std::vector<double>>& logits) const {
+        std::mt19937 gen;
+        std::seed_seq seed{uint64_t{7}, uint64_t{11}};
+        gen.seed(seed);
+        std::vector<int64_t> tokens;
+        for (const auto& row : logits) {
+            std::vector<size_t> ids(V);
+            for (size_t v = 0; v < V; v++) {
+                ids[v] = v;
+            }
+            if (GetParam().mode == SamplingMode::Greedy) {
+                tokens.push_back(std::max_element(row.begin(), row.end()) - row.begin());
+                continue;
+            }
+            if (GetParam().mode == SamplingMode::TopK) {
+                std::stable_sort(ids.begin(), ids.end(), [&](size_t a, size_t b) {
+                    return row[a] > row[b];
+                });
+                ids.resize(top_k);
+                if (GetParam().sort == "index") {
+                    std::sort(ids.begin(), ids.end());
+                }
+            }
+            const double max = row[ids[0]];
+            std::vector<double> cdf;
+            double sum = 0.0;
+            for (const auto id : ids) {
+                sum += std::exp((row[id] - max) / temperature);
+                cdf.push_back(sum);
+            }
+            const auto random = static_cast<float>(gen()) / static_cast<float>(std::mt19937::max());
+            const auto selected = std::find_if(cdf.begin(), cdf.end(), [&](double c) {
+                return random <= c / sum;
+            });
+            tokens.push_back(ids[std::min<size_t>(selected - cdf.begin(), ids.size() - 1)]);
+        }
+        return tokens;
+    }
+
+    void check_fusion() {
+        // only the candidates sorted by value are fused, the CPU TopK returns the unsorted ones in the same order
+        const bool fused =
+            GetParam().enabled && (GetParam().mode != SamplingMode::TopK || GetParam().sort == "value");
+        int fused_node_found = 0;
+        for (const auto& n : compiledModel.get_runtime_model()->get_ordered_ops()) {
+            auto layer_type = n->get_rt_info().at(ov::exec_model_info::LAYER_TYPE).as<std::string>();
+            if (layer_type == "LMHeadSampling") {
+                fused_node_found++;
+            }
+            if (fused) {
+                ASSERT_NE(layer_type, "TopK");
+                ASSERT_NE(layer_type, "Multinomial");
+                ASSERT_NE(layer_type, "FullyConnected");
+            }
+        }
+        ASSERT_EQ(fused_node_found, fused ? 1 : 0);
+    }
+
+    static constexpr size_t V = 300;
+    static constexpr size_t H = 48;
+    const float temperature = 0.7f;
+    const int top_k = 20;
+    std::vector<float> weights;
+};
+
+TEST_P(LMHeadSamplingTest, CompareWithHostReference) {
+    compile_model();
+    check_fusion();
+    auto request = compiledModel.create_infer_request();
+
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    for (const size_t B : {1, 3, 5}) {
+        ov::Tensor hidden(ov::element::f32, {B, H});
+        auto* data = hidden.data<float>();
+        for (size_t i = 0; i < B * H; i++) {
+            data[i] = dist(gen);
+        }
+        request.set_input_tensor(hidden);
+        request.infer();
+
+        std::vector<std::vector<double>> logits(B, std::vector<double>(V, 0.0));
+        for (size_t b = 0; b < B; b++) {
+            for (size_t v = 0; v < V; v++) {
+                for (size_t h = 0; h < H; h++) {
+                    logits[b][v] += static_cast<double>(data[b * H + h]) * weights[v * H + h];
+                }
+            }
+        }
+
+        const auto expected = expected_tokens(logits);
+        const auto tokens = request.get_output_tensor(0);
+        ASSERT_EQ(tokens.get_shape(), (ov::Shape{B, 1}));
+        for (size_t b = 0; b < B; b++) {
+            const int64_t token = tokens.get_element_type() == ov::element::i64 ? tokens.data<int64_t>()[b]
+                                                                               : tokens.data<int32_t>()[b];
+            ASSERT_EQ(token, expected[b]) << "B=" << B << " b=" << b;
+        }
+
+        if (GetParam().with_logits) {
+            const auto actual = request.get_output_tensor(1);
+            ASSERT_EQ(actual.get_shape(), (ov::Shape{B, V}));
+            for (size_t b = 0; b < B; b++) {
+                for (size_t v = 0; v < V; v++) {
+                    ASSERT_NEAR(actual.data<float>()[b * V + v], logits[b][v], 1e-4) << "b=" << b << " v=" << v;
+                }
+            }
+        }
+    }
+}
+
+namespace {
+
+const std::vector<LMHeadSamplingParams> lm_head_sampling_params = {
+    {SamplingMode::Greedy, false, false},
+    {SamplingMode::Greedy, true, true},
+    {SamplingMode::TopK, false, false},
+    {SamplingMode::TopK, false, true},
+    {SamplingMode::TopK, true, false},
+    {SamplingMode::TopK, false, false, "index"},
+    {SamplingMode::TopK, false, false, "none"},
+    {SamplingMode::All, false, false},
+    {SamplingMode::All, true, true},
+    {SamplingMode::Greedy, false, false, "value", false},
+    {SamplingMode::TopK, false, false, "value", false},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_LMHeadSampling,
+                         LMHeadSamplingTest,
+                         ::testing::ValuesIn(lm_head_sampling_params),
+                         LMHeadSamplingTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,127 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/i420_to_bgr.hpp"
+#include "openvino/op/i420_to_rgb.hpp"
+#include "openvino/op/nv12_to_bgr.hpp"
+#include "openvino/op/nv12_to_rgb.hpp"
+
+using namespace CPUTestUtils;
+
+/*This test covers the typical preprocessing pipeline where u8 YUV planes are converted to f32 right before
+ * the color conversion. The Converts are expected to be merged into the ColorConvert node, which reads
+ * the u8 planes and writes the f32 result directly.
+
+    Param (u8)   [Param (u8)]   [Param (u8)]
+        |             |              |
+     Convert       Convert        Convert
+        \             |             /
+         \            |            /
+          NV12/I420 to RGB/BGR (f32)
+                      |
+                    Result
+*/
+
+namespace ov {
+namespace test {
+
+enum class YUVFormat { NV12, I420 };
+
+using MergeConvertColorConvertParams = std::tuple<YUVFormat,
+                                                  bool,   // single plane
+                                                  bool>;  // RGB, otherwise BGR
+
+class MergeConvertColorConvertCPUTest : public testing::WithParamInterface<MergeConvertColorConvertParams>,
+                                        virtual public SubgraphBaseTest,
+                                        public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<MergeConvertColorConvertParams>& obj) {
+        YUVFormat format;
+        bool singlePlane;
+        bool isRGB;
+        std::tie(format, singlePlane, isRGB) = obj.param;
+
+        std::ostringstream result;
+        result << (format == YUVFormat::NV12 ? "NV12" : "I420") << "_";
+        result << "singlePlane=" << singlePlane << "_";
+        result << (isRGB ? "RGB" : "BGR");
+        return result.str();
+    }
+
+protected:
+    template <typename Op>
+    static std::shared_ptr<ov::Node> makeColorConvert(const ov::OutputVector& planes) {
+        if (planes.size() == 1) {
+            return std::make_shared<Op>(planes[0]);
+        }
+        // NV12 has two planes, I420 has three ones
+        if constexpr (std::is_constructible_v<Op, ov::Output<ov::Node>, ov::Output<ov::Node>>) {
+            return std::make_shared<Op>(planes[0], planes[1]);
+        } else {
+            return std::make_shared<Op>(planes[0], planes[1], planes[2]);
+        }
+    }
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        YUVFormat format;
+        bool singlePlane;
+        bool isRGB;
+        std::tie(format, singlePlane, isRGB) = this->GetParam();
+
+        // the width is not a multiple of the vector length to cover the tail processing
+        const size_t batch = 2, height = 8, width = 22;
+        std::vector<ov::Shape> shapes;
+        if (singlePlane) {
+            shapes.push_back({batch, height * 3 / 2, width, 1});
+        } else if (format == YUVFormat::NV12) {
+            shapes.push_back({batch, height, width, 1});
+            shapes.push_back({batch, height / 2, width / 2, 2});
+        } else {
+            shapes.push_back({batch, height, width, 1});
+            shapes.push_back({batch, height / 2, width / 2, 1});
+            shapes.push_back({batch, height / 2, width / 2, 1});
+        }
+        init_input_shapes(static_shapes_to_test_representation(shapes));
+
+        ov::ParameterVector params;
+        ov::OutputVector planes;
+        for (auto&& shape : inputDynamicShapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::u8, shape));
+            planes.push_back(std::make_shared<ov::op::v0::Convert>(params.back(), ov::element::f32));
+        }
+
+        std::shared_ptr<ov::Node> colorConvert;
+        if (format == YUVFormat::NV12) {
+            colorConvert = isRGB ? makeColorConvert<ov::op::v8::NV12toRGB>(planes)
+                                 : makeColorConvert<ov::op::v8::NV12toBGR>(planes);
+        } else {
+            colorConvert = isRGB ? makeColorConvert<ov::op::v8::I420toRGB>(planes)
+                                 : makeColorConvert<ov::op::v8::I420toBGR>(planes);
+        }
+
+        function = std::make_shared<ov::Model>(ov::OutputVector{colorConvert}, params, "MergeConvertColorConvert");
+    }
+};
+
+TEST_P(MergeConvertColorConvertCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Convert", 0);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_MergeConvertColorConvert,
+                         MergeConvertColorConvertCPUTest,
+                         ::testing::Combine(::testing::Values(YUVFormat::NV12, YUVFormat::I420),
+                                            ::testing::Bool(),
+                                            ::testing::Bool()),
+                         MergeConvertColorConvertCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
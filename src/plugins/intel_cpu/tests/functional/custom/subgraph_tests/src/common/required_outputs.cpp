@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/relu.hpp"
+
+/*This test covers the inference of a part of the model outputs.
+ * The nodes which contribute only to the outputs that are not required must not be executed,
+ * while the shared part of the graph and the required heads must produce the correct results.
+
+                 Param
+                   |
+                 Relu
+                 |  |
+     +-----------+  +-----------+
+     |                          |
+  Add (head_a)        Multiply (head_b)
+     |                          |
+   Result                     Result
+*/
+
+namespace CPUSubgraphTestsDefinitions {
+
+class RequiredOutputs : public ov::test::SubgraphBaseTest {
+public:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert(ov::enable_profiling(true));
+        // keep the heads as separate nodes
+        configuration.insert(ov::intel_cpu::snippets_mode(ov::intel_cpu::SnippetsMode::DISABLE));
+        const auto precision = ov::element::f32;
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, shape);
+        auto relu = std::make_shared<ov::op::v0::Relu>(param);
+        auto headA = std::make_shared<ov::op::v1::Add>(relu, ov::op::v0::Constant::create(precision, {1}, {1.f}));
+        headA->set_friendly_name("head_a");
+        auto headB = std::make_shared<ov::op::v1::Multiply>(relu, ov::op::v0::Constant::create(precision, {1}, {2.f}));
+        headB->set_friendly_name("head_b");
+
+        function = std::make_shared<ov::Model>(ov::OutputVector{headA, headB}, ov::ParameterVector{param});
+    }
+
+protected:
+    void infer(ov::InferRequest& request, float value) {
+        ov::Tensor input(ov::element::f32, shape);
+        std::fill_n(input.data<float>(), input.get_size(), value);
+        request.set_input_tensor(input);
+        request.infer();
+    }
+
+    static void check(const ov::Tensor& tensor, float expected) {
+        const auto* data = tensor.data<const float>();
+        for (size_t i = 0; i < tensor.get_size(); ++i) {
+            ASSERT_EQ(data[i], expected) << "at index " << i;
+        }
+    }
+
+    static bool executed(ov::InferRequest& request, const std::string& name) {
+        for (const auto& info : request.get_profiling_info()) {
+            if (info.node_name == name) {
+                return info.status == ov::ProfilingInfo::Status::EXECUTED;
+            }
+        }
+        ADD_FAILURE() << "Cannot find the node " << name << " in the profiling info";
+        return false;
+    }
+
+    const ov::Shape shape = {2, 16};
+};
+
+TEST_F(RequiredOutputs, smoke_RequiredOutputsSkipUnneededHead) {
+    compile_model();
+    auto request = compiledModel.create_infer_request();
+
+    // the profiling counters are accumulated, so the head must not have been executed at all
+    request.set_required_outputs({compiledModel.output(0)});
+    infer(request, 3.f);
+    check(request.get_output_tensor(0), 4.f);
+    ASSERT_FALSE(executed(request, "head_b"));
+
+    // another subset of the outputs
+    request.set_required_outputs({compiledModel.output(1)});
+    infer(request, 5.f);
+    check(request.get_output_tensor(1), 10.f);
+
+    // all the outputs
+    request.set_required_outputs({});
+    infer(request, 2.f);
+    check(request.get_output_tensor(0), 3.f);
+    check(request.get_output_tensor(1), 4.f);
+}
+
+TEST_F(RequiredOutputs, smoke_RequiredOutputsUnknownPort) {
+    compile_model();
+    auto request = compiledModel.create_infer_request();
+    ASSERT_THROW(request.set_required_outputs({compiledModel.input(0)}), ov::Exception);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
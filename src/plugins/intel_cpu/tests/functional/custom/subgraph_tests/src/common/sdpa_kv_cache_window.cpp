@@ -0,0 +1,348 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "internal_properties.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/scaled_dot_product_attention.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace ov::test;
+
+// The bounded KV-cache keeps the first sink tokens and the last window tokens of the sequence. The outputs are
+// compared with the attention over the expected cache content, where the sink keys are rotated to the positions
+// right before the window, and the states are compared with the expected cache content.
+// The beams are reordered before the attention, and the optional mask spans all the tokens of the sequence.
+//
+//       Parameter    ReadValue         ReadValue  Parameter
+//           \           /                  \          /
+//         Gather       /    Parameter    Gather      /
+//             \       /         |           \       /
+//               Concat          |            Concat
+//                / \            |             / \
+//          Assign   ScaledDotProductAttention    Assign
+//                               |      \
+//                             Result   Parameter (optional mask)
+
+namespace CPUSubgraphTestsDefinitions {
+
+struct SDPAKVCacheWindowParams {
+    ov::element::Type kv_precision;
+    size_t batch;
+    bool with_mask;
+};
+
+class SDPAKVCacheWindowTest : public testing::WithParamInterface<SDPAKVCacheWindowParams>, public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SDPAKVCacheWindowParams>& obj) {
+        std::ostringstream result;
+        result << "kv_precision=" << obj.param.kv_precision << "_B=" << obj.param.batch
+               << "_mask=" << obj.param.with_mask;
+        return result.str();
+    }
+
+    void SetUp() override {
+        const auto& param = GetParam();
+        B = param.batch;
+        with_mask = param.with_mask;
+        // the u8 cache requantizes the rotated sink keys on eviction
+        threshold = param.kv_precision == ov::element::u8 ? 0.05f : 1e-4f;
+        targetDevice = utils::DEVICE_CPU;
+        configuration[ov::hint::inference_precision.name()] = ov::element::f32;
+        configuration[ov::hint::kv_cache_precision.name()] = param.kv_precision;
+        configuration[ov::intel_cpu::key_cache_quant_mode.name()] = ov::intel_cpu::CacheQuantMode::BY_HIDDEN;
+        configuration[ov::intel_cpu::kv_cache_sink_size.name()] = sink;
+        configuration[ov::intel_cpu::kv_cache_window_size.name()] = window;
+        configuration[ov::intel_cpu::kv_cache_rope_theta.name()] = theta;
+
+        const ov::PartialShape shape{-1, H, -1, S};
+        auto q = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+        auto k = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+        auto v = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+        auto init_k = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+        auto init_v = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+        auto beam_idx = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+        auto var_k =
+            std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, ov::element::f32, "pastk"});
+        auto var_v =
+            std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, ov::element::f32, "pastv"});
+        auto past_k = std::make_shared<ov::op::v6::ReadValue>(init_k, var_k);
+        auto past_v = std::make_shared<ov::op::v6::ReadValue>(init_v, var_v);
+        auto axis = ov::op::v0::Constant::create(ov::element::i32, {}, {0});
+        auto gather_k = std::make_shared<ov::op::v8::Gather>(past_k, beam_idx, axis);
+        auto gather_v = std::make_shared<ov::op::v8::Gather>(past_v, beam_idx, axis);
+        auto concat_k = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{gather_k, k}, 2);
+        auto concat_v = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{gather_v, v}, 2);
+        ov::ParameterVector params{q, k, v, init_k, init_v, beam_idx};
+        std::shared_ptr<ov::op::v13::ScaledDotProductAttention> sdpa;
+        if (with_mask) {
+            auto mask = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, 1, -1, -1});
+            params.push_back(mask);
+            sdpa = std::make_shared<ov::op::v13::ScaledDotProductAttention>(q, concat_k, concat_v, mask, false);
+        } else {
+            sdpa = std::make_shared<ov::op::v13::ScaledDotProductAttention>(q, concat_k, concat_v, false);
+        }
+        auto assign_k = std::make_shared<ov::op::v6::Assign>(concat_k, var_k);
+        auto assign_v = std::make_shared<ov::op::v6::Assign>(concat_v, var_v);
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(sdpa)},
+                                               ov::SinkVector{assign_k, assign_v},
+                                               params);
+        past_k.resize(B);
+        past_v.resize(B);
+    }
+
+protected:
+    using Tokens = std::vector<std::vector<float>>;  // [L, H * S]
+    using Batch = std::vector<Tokens>;               // [B, L, H * S]
+
+    Batch random_tokens(size_t L) {
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+        Batch batch(B, Tokens(L, std::vector<float>(H * S)));
+        for (auto& tokens : batch) {
+            for (auto& token : tokens) {
+                for (auto& value : token) {
+                    value = dist(gen);
+                }
+            }
+        }
+        return batch;
+    }
+
+    static ov::Tensor to_tensor(const Batch& batch) {
+        const size_t L = batch[0].size();
+        ov::Tensor tensor(ov::element::f32, {batch.size(), H, L, S});
+        auto* data = tensor.data<float>();
+        for (size_t b = 0; b < batch.size(); b++) {
+            for (size_t h = 0; h < H; h++) {
+                for (size_t l = 0; l < L; l++) {
+                    std::copy_n(batch[b][l].data() + h * S, S, data + ((b * H + h) * L + l) * S);
+                }
+            }
+        }
+        return tensor;
+    }
+
+    // llama-style rotation of the keys by the given number of positions
+    std::vector<float> rotate(const std::vector<float>& key, size_t delta) const {
+        std::vector<float> result(key);
+        for (size_t h = 0; h < H; h++) {
+            for (size_t i = 0; i < S / 2; i++) {
+                const double angle = delta * std::pow(static_cast<double>(theta), -2.0 * i / S);
+                const double x = key[h * S + i];
+                const double y = key[h * S + i + S / 2];
+                result[h * S + i] = static_cast<float>(x * std::cos(angle) - y * std::sin(angle));
+                result[h * S + i + S / 2] = static_cast<float>(x * std::sin(angle) + y * std::cos(angle));
+            }
+        }
+        return result;
+    }
+
+    // the expected cache content: the rotated sinks and the latest window tokens
+    Batch cached_keys() const {
+        Batch keys(B);
+        for (size_t b = 0; b < B; b++) {
+            for (size_t l = 0; l < past_k[b].size(); l++) {
+                keys[b].push_back(l < sink ? rotate(past_k[b][l], evicted) : past_k[b][l]);
+            }
+        }
+        return keys;
+    }
+
+    void check(const ov::Tensor& actual, const Batch& expected) const {
+        const size_t L = expected[0].size();
+        ASSERT_EQ(actual.get_shape(), (ov::Shape{B, H, L, S}));
+        const auto* data = actual.data<const float>();
+        for (size_t b = 0; b < B; b++) {
+            for (size_t h = 0; h < H; h++) {
+                for (size_t l = 0; l < L; l++) {
+                    for (size_t s = 0; s < S; s++) {
+                        ASSERT_NEAR(data[((b * H + h) * L + l) * S + s], expected[b][l][h * S + s], threshold)
+                            << "b=" << b << " h=" << h << " l=" << l << " s=" << s;
+                    }
+                }
+            }
+        }
+    }
+
+    // beam[b] is the beam of the previous step which the cache of the b-th beam is taken from
+    void step(ov::InferRequest& request, size_t L1, const std::vector<int32_t>& beam = {}) {
+        const auto q = random_tokens(L1);
+        const auto k = random_tokens(L1);
+        const auto v = random_tokens(L1);
+        const ov::Tensor init(ov::element::f32, {B, H, 0, S});
+        ov::Tensor beam_idx(ov::element::i32, {B});
+        for (size_t b = 0; b < B; b++) {
+            beam_idx.data<int32_t>()[b] = beam.empty() ? static_cast<int32_t>(b) : beam[b];
+        }
+        const auto& params = function->get_parameters();
+        request.set_tensor(params[0], to_tensor(q));
+        request.set_tensor(params[1], to_tensor(k));
+        request.set_tensor(params[2], to_tensor(v));
+        request.set_tensor(params[3], init);
+        request.set_tensor(params[4], init);
+        request.set_tensor(params[5], beam_idx);
+
+        // the cache of every beam is reordered before the attention
+        if (!beam.empty()) {
+            Batch reordered_k(B);
+            Batch reordered_v(B);
+            for (size_t b = 0; b < B; b++) {
+                reordered_k[b] = past_k[beam[b]];
+                reordered_v[b] = past_v[beam[b]];
+            }
+            past_k = std::move(reordered_k);
+            past_v = std::move(reordered_v);
+        }
+
+        // the mask spans all the tokens of the sequence, including the evicted ones
+        const size_t cached = past_k[0].size();
+        const size_t total = evicted + cached + L1;
+        std::vector<float> mask;
+        if (with_mask) {
+            std::uniform_real_distribution<float> dist(-3.0f, 0.0f);
+            mask.resize(L1 * total);
+            for (auto& value : mask) {
+                value = dist(gen);
+            }
+            ov::Tensor mask_tensor(ov::element::f32, {1, 1, L1, total});
+            std::copy(mask.begin(), mask.end(), mask_tensor.data<float>());
+            request.set_tensor(params[6], mask_tensor);
+        }
+        // the position of the cached token in the sequence, the sinks are followed by the window tokens
+        auto position = [&](size_t j) {
+            return j < sink ? j : evicted + j;
+        };
+        request.infer();
+
+        // all the queries attend to the cached tokens and to all the current ones
+        auto keys = cached_keys();
+        auto values = past_v;
+        Batch expected(B, Tokens(L1, std::vector<float>(H * S, 0.0f)));
+        for (size_t b = 0; b < B; b++) {
+            keys[b].insert(keys[b].end(), k[b].begin(), k[b].end());
+            values[b].insert(values[b].end(), v[b].begin(), v[b].end());
+            for (size_t h = 0; h < H; h++) {
+                for (size_t i = 0; i < L1; i++) {
+                    std::vector<double> weights(keys[b].size());
+                    double max_weight = -1e30;
+                    for (size_t j = 0; j < keys[b].size(); j++) {
+                        double dot = 0.0;
+                        for (size_t s = 0; s < S; s++) {
+                            dot += q[b][i][h * S + s] * keys[b][j][h * S + s];
+                        }
+                        weights[j] = dot / std::sqrt(static_cast<double>(S));
+                        if (with_mask) {
+                            weights[j] += mask[i * total + position(j)];
+                        }
+                        max_weight = std::max(max_weight, weights[j]);
+                    }
+                    double sum = 0.0;
+                    for (auto& w : weights) {
+                        w = std::exp(w - max_weight);
+                        sum += w;
+                    }
+                    for (size_t j = 0; j < keys[b].size(); j++) {
+                        for (size_t s = 0; s < S; s++) {
+                            expected[b][i][h * S + s] += static_cast<float>(weights[j] / sum * values[b][j][h * S + s]);
+                        }
+                    }
+                }
+            }
+        }
+        check(request.get_output_tensor(0), expected);
+
+        // evict the oldest window tokens
+        for (size_t b = 0; b < B; b++) {
+            past_k[b].insert(past_k[b].end(), k[b].begin(), k[b].end());
+            past_v[b].insert(past_v[b].end(), v[b].begin(), v[b].end());
+        }
+        if (past_k[0].size() > sink + window) {
+            const size_t count = past_k[0].size() - sink - window;
+            for (size_t b = 0; b < B; b++) {
+                past_k[b].erase(past_k[b].begin() + sink, past_k[b].begin() + sink + count);
+                past_v[b].erase(past_v[b].begin() + sink, past_v[b].begin() + sink + count);
+            }
+            evicted += count;
+        }
+        for (auto&& state : request.query_state()) {
+            check(state.get_state(), state.get_name() == "pastk" ? cached_keys() : past_v);
+        }
+    }
+
+    static constexpr size_t H = 2;
+    static constexpr size_t S = 16;
+    const size_t sink = 2;
+    const size_t window = 6;
+    const float theta = 10000.0f;
+    size_t B = 1;
+    bool with_mask = false;
+    float threshold = 1e-4f;
+
+    std::mt19937 gen{42};
+    Batch past_k;  // the sink keys are kept in their original positions
+    Batch past_v;
+    size_t evicted = 0;
+};
+
+TEST_P(SDPAKVCacheWindowTest, CompareWithRefs) {
+    compile_model();
+    auto request = compiledModel.create_infer_request();
+    // the prompt, the decoding through several turns of the ring, another prompt over the wrapped ring
+    for (const size_t L1 : {5, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 1, 1, 10, 1, 1}) {
+        step(request, L1);
+    }
+
+    // the beams are reordered while the ring is wrapped, the evicted tokens and the sinks follow their beams
+    if (B > 1) {
+        std::vector<int32_t> reversed(B);
+        for (size_t b = 0; b < B; b++) {
+            reversed[b] = static_cast<int32_t>(B - 1 - b);
+        }
+        const std::vector<int32_t> first(B, 0);
+        for (const auto& beam : {reversed, first, reversed}) {
+            step(request, 1, beam);
+        }
+        step(request, 4, reversed);
+    }
+
+    // the cache starts from the scratch after reset
+    for (auto&& state : request.query_state()) {
+        state.reset();
+    }
+    for (size_t b = 0; b < B; b++) {
+        past_k[b].clear();
+        past_v[b].clear();
+    }
+    evicted = 0;
+    for (const size_t L1 : {9, 1, 1}) {
+        step(request, L1);
+    }
+}
+
+namespace {
+
+const std::vector<SDPAKVCacheWindowParams> params = {
+    {ov::element::f32, 1, false},
+    {ov::element::u8, 1, false},
+    {ov::element::f32, 3, false},
+    {ov::element::u8, 3, false},
+    {ov::element::f32, 1, true},
+    {ov::element::f32, 3, true},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SDPAKVCacheWindow,
+                         SDPAKVCacheWindowTest,
+                         ::testing::ValuesIn(params),
+                         SDPAKVCacheWindowTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,167 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/negative.hpp"
+
+using namespace ov::test;
+
+// The state accumulates the inputs of all the inferences.
+// The tensors returned by snapshot() share the memory with the state, so they must keep their values
+// while the state is being updated, and they can be used to restore or fork the state by set_state().
+//
+// ┌────────┐    ┌───────────┐
+// │ Param  │    │ ReadValue │..
+// └───┬────┘    └─────┬─────┘ .
+//     │               │       .
+//     └─────┬─────┬───┘       .
+//           │ Add │           .
+//           └──┬──┘           .
+//             / \             .
+//   ┌────────┐   ┌────────┐   .
+//   │ Result │   │ Assign │....
+//   └────────┘   └────────┘
+
+namespace CPUSubgraphTestsDefinitions {
+
+class VariableStateSnapshot : public SubgraphBaseTest {
+public:
+    void SetUp() override {
+        targetDevice = utils::DEVICE_CPU;
+        const auto netPrc = ov::element::f32;
+
+        auto arg = std::make_shared<ov::op::v0::Parameter>(netPrc, shape);
+        auto variable = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, netPrc, "variable0"});
+        auto read = std::make_shared<ov::op::v6::ReadValue>(variable);
+        auto add = std::make_shared<ov::op::v1::Add>(arg, read);
+        auto assign = std::make_shared<ov::op::v6::Assign>(add, variable);
+        auto res = std::make_shared<ov::op::v0::Result>(add);
+        function = std::make_shared<ov::Model>(ov::ResultVector({res}),
+                                               ov::SinkVector({assign}),
+                                               ov::ParameterVector({arg}));
+    }
+
+protected:
+    static void check(const ov::Tensor& tensor, float expected) {
+        const auto* data = tensor.data<const float>();
+        for (size_t i = 0; i < tensor.get_size(); ++i) {
+            ASSERT_EQ(data[i], expected) << "at index " << i;
+        }
+    }
+
+    float infer(ov::InferRequest& request, float value) {
+        ov::Tensor input(ov::element::f32, shape);
+        std::fill_n(input.data<float>(), input.get_size(), value);
+        request.set_input_tensor(input);
+        request.infer();
+        return request.get_output_tensor().data<const float>()[0];
+    }
+
+    const ov::Shape shape = {2, 16};
+};
+
+TEST_F(VariableStateSnapshot, smoke_VariableStateSnapshotRestoreFork) {
+    compile_model();
+    auto request = compiledModel.create_infer_request();
+    auto state = request.query_state().front();
+
+    infer(request, 1.f);
+    infer(request, 1.f);
+    const auto snapshot = state.snapshot();
+    check(snapshot, 2.f);
+    auto shared = state.snapshot();
+    ASSERT_THROW(shared.data<float>(), ov::Exception);
+
+    // the snapshot isn't affected by the following inferences
+    for (int i = 0; i < 3; ++i) {
+        infer(request, 1.f);
+        check(snapshot, 2.f);
+    }
+    check(state.get_state(), 5.f);
+
+    // restore
+    state.set_state(snapshot);
+    ASSERT_EQ(infer(request, 1.f), 3.f);
+    ASSERT_EQ(infer(request, 1.f), 4.f);
+    check(snapshot, 2.f);
+
+    // fork into another request
+    auto forked = compiledModel.create_infer_request();
+    forked.query_state().front().set_state(snapshot);
+    ASSERT_EQ(infer(forked, 10.f), 12.f);
+    ASSERT_EQ(infer(request, 1.f), 5.f);
+    ASSERT_EQ(infer(forked, 10.f), 22.f);
+    check(snapshot, 2.f);
+
+    // reset doesn't touch the snapshot
+    state.set_state(snapshot);
+    state.reset();
+    check(snapshot, 2.f);
+    ASSERT_EQ(infer(request, 1.f), 1.f);
+
+    // regular tensors are still copied into the state
+    ov::Tensor external(ov::element::f32, shape);
+    std::fill_n(external.data<float>(), external.get_size(), 7.f);
+    state.set_state(external);
+    std::fill_n(external.data<float>(), external.get_size(), 0.f);
+    ASSERT_EQ(infer(request, 1.f), 8.f);
+}
+
+// The unary eltwise may run in place on the ReadValue output, so the snapshot must not share the state memory
+//
+// ┌────────┐
+// │ Param  │
+// └───┬────┘
+//     │
+// ┌───┴───────┐
+// │ ReadValue │.....
+// └─────┬─────┘    .
+//  ┌────┴─────┐    .
+//  │ Negative │    .
+//  └────┬─────┘    .
+//      / \         .
+// ┌────────┐  ┌────────┐
+// │ Result │  │ Assign │
+// └────────┘  └────────┘
+class VariableStateSnapshotInPlace : public VariableStateSnapshot {
+public:
+    void SetUp() override {
+        targetDevice = utils::DEVICE_CPU;
+        const auto netPrc = ov::element::f32;
+
+        auto arg = std::make_shared<ov::op::v0::Parameter>(netPrc, shape);
+        auto variable = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, netPrc, "variable0"});
+        auto read = std::make_shared<ov::op::v6::ReadValue>(arg, variable);
+        auto negative = std::make_shared<ov::op::v0::Negative>(read);
+        auto assign = std::make_shared<ov::op::v6::Assign>(negative, variable);
+        auto res = std::make_shared<ov::op::v0::Result>(negative);
+        function = std::make_shared<ov::Model>(ov::ResultVector({res}),
+                                               ov::SinkVector({assign}),
+                                               ov::ParameterVector({arg}));
+    }
+};
+
+TEST_F(VariableStateSnapshotInPlace, smoke_VariableStateSnapshotInPlaceConsumer) {
+    compile_model();
+    auto request = compiledModel.create_infer_request();
+    auto state = request.query_state().front();
+
+    ASSERT_EQ(infer(request, 3.f), -3.f);
+    const auto snapshot = state.snapshot();
+    check(snapshot, -3.f);
+
+    // the next inference negates the state read from the prime buffer
+    ASSERT_EQ(infer(request, 3.f), 3.f);
+    check(snapshot, -3.f);
+    ASSERT_EQ(infer(request, 3.f), -3.f);
+    check(snapshot, -3.f);
+
+    state.set_state(snapshot);
+    ASSERT_EQ(infer(request, 3.f), 3.f);
+    check(snapshot, -3.f);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -30,6 +30,14 @@ const std::vector<std::vector<InputShape>> inputShapes = {
         // B, H, L0, S
         {{-1, 8, -1, 64}, {{4, 8, 0, 64}, {4, 8, 10, 64}, {4, 8, 11, 64}, {4, 8, 12, 64}, {4, 8, 13, 64}}},
     },
+    // beam search with a long prompt over the past kv cache, it is processed by blocks of keys gathered
+    // by the beam table (and dequantized for the u8 cache)
+    {
+        // B, H, L1, S
+        {{-1, 8, -1, 64}, {{2, 8, 600, 64}, {2, 8, 1, 64}, {2, 8, 64, 64}, {2, 8, 1, 64}}},
+        // B, H, L0, S
+        {{-1, 8, -1, 64}, {{2, 8, 0, 64}, {2, 8, 600, 64}, {2, 8, 601, 64}, {2, 8, 665, 64}}},
+    },
     // big batch to check cvt_copy fast-path inside mha_single_token_kernel
     {
         // B, H, L1, S
@@ -0,0 +1,173 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/embedding_segments_sum.hpp"
+#include "openvino/op/embeddingbag_offsets_sum.hpp"
+#include "openvino/op/embeddingbag_packedsum.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "transformations/rt_info/decompression.hpp"
+
+/*This test covers the embedding tables which are kept compressed and dequantized by the embedding bag node.
+ * A few bags with the long rows are split along the embedding depth between the threads.
+
+    Const [rows, depth] (u8/i8/f16)
+          |
+       Convert
+          |
+    Subtract(zp [rows, 1]) (optional)
+          |
+    Multiply(scales [rows, 1]) (u8/i8 only)
+          |
+    EmbeddingBagOffsetsSum / EmbeddingBagPackedSum / EmbeddingSegmentsSum  <-  Param(per sample weights)
+          |
+        Result
+*/
+
+namespace ov {
+namespace test {
+
+enum class EmbeddingBagType { Offsets, Packed, Segments };
+
+struct EmbeddingBagCompressedParams {
+    EmbeddingBagType type;
+    ov::element::Type table_precision;
+    bool with_zero_point;
+    size_t depth;
+};
+
+class EmbeddingBagCompressedTest : public testing::WithParamInterface<EmbeddingBagCompressedParams>,
+                                   virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<EmbeddingBagCompressedParams>& obj) {
+        const auto& p = obj.param;
+        std::ostringstream result;
+        result << "type="
+               << (p.type == EmbeddingBagType::Offsets  ? "offsets"
+                   : p.type == EmbeddingBagType::Packed ? "packed"
+                                                        : "segments");
+        result << "_table=" << p.table_precision << "_zp=" << p.with_zero_point << "_depth=" << p.depth;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        const auto& p = GetParam();
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration[ov::hint::inference_precision.name()] = ov::element::f32;
+        abs_threshold = 1e-4;
+
+        const size_t rows = 20;
+        ov::test::utils::InputGenerateData in_data;
+        in_data.start_from = p.table_precision == ov::element::i8 ? -64 : 0;
+        in_data.range = p.table_precision == ov::element::f16 ? 2 : 127;
+        in_data.resolution = p.table_precision == ov::element::f16 ? 64 : 1;
+        auto table = std::make_shared<ov::op::v0::Constant>(
+            ov::test::utils::create_and_fill_tensor(p.table_precision, ov::Shape{rows, p.depth}, in_data));
+        auto table_f32 = std::make_shared<ov::op::v0::Convert>(table, ov::element::f32);
+        std::shared_ptr<ov::Node> decompressed = table_f32;
+        if (p.table_precision == ov::element::f16) {
+            ov::mark_as_decompression(table_f32);
+        } else {
+            if (p.with_zero_point) {
+                in_data.start_from = 0;
+                in_data.range = 16;
+                in_data.resolution = 1;
+                auto zp = ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{rows, 1}, in_data);
+                decompressed =
+                    std::make_shared<ov::op::v1::Subtract>(decompressed, std::make_shared<ov::op::v0::Constant>(zp));
+            }
+            in_data.start_from = 0.01;
+            in_data.range = 1;
+            in_data.resolution = 1024;
+            auto scales = ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{rows, 1}, in_data);
+            decompressed =
+                std::make_shared<ov::op::v1::Multiply>(decompressed, std::make_shared<ov::op::v0::Constant>(scales));
+        }
+
+        // the bags of the rows 1, 4, 7 and of the rows 19, 0
+        const std::vector<int32_t> indices{1, 4, 7, 19, 0};
+        auto default_index = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {3});
+        std::shared_ptr<ov::Node> embedding_bag;
+        std::shared_ptr<ov::op::v0::Parameter> weights;
+        if (p.type == EmbeddingBagType::Packed) {
+            init_input_shapes({InputShape{{2, 2}, {ov::Shape{2, 2}}}});
+            weights = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0]);
+            auto packed = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{2, 2}, {1, 4, 19, 0});
+            embedding_bag = std::make_shared<ov::op::v3::EmbeddingBagPackedSum>(decompressed, packed, weights);
+        } else {
+            init_input_shapes({InputShape{{5}, {ov::Shape{5}}}});
+            weights = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0]);
+            auto ids = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{5}, indices);
+            if (p.type == EmbeddingBagType::Offsets) {
+                // the bag 1 is empty and takes the default index
+                auto offsets = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{3}, {0, 3, 3});
+                embedding_bag = std::make_shared<ov::op::v3::EmbeddingBagOffsetsSum>(decompressed,
+                                                                                      ids,
+                                                                                      offsets,
+                                                                                      default_index,
+                                                                                      weights);
+            } else {
+                // the segment 1 is empty and takes the default index
+                auto segment_ids = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{5}, {0, 0, 0, 2, 2});
+                auto num_segments = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {3});
+                embedding_bag = std::make_shared<ov::op::v3::EmbeddingSegmentsSum>(decompressed,
+                                                                                   ids,
+                                                                                   segment_ids,
+                                                                                   num_segments,
+                                                                                   default_index,
+                                                                                   weights);
+            }
+        }
+
+        function = std::make_shared<ov::Model>(ov::OutputVector{embedding_bag},
+                                               ov::ParameterVector{weights},
+                                               "EmbeddingBagCompressed");
+    }
+
+    void check_results() {
+        for (const auto& n : compiledModel.get_runtime_model()->get_ordered_ops()) {
+            auto layer_type = n->get_rt_info().at(ov::exec_model_info::LAYER_TYPE).as<std::string>();
+            ASSERT_NE(layer_type, "Convert");
+            ASSERT_NE(layer_type, "Eltwise");
+        }
+    }
+};
+
+TEST_P(EmbeddingBagCompressedTest, CompareWithRefs) {
+    run();
+    check_results();
+}
+
+namespace {
+
+const std::vector<EmbeddingBagCompressedParams> embedding_bag_compressed_params = {
+    {EmbeddingBagType::Offsets, ov::element::u8, true, 16},
+    {EmbeddingBagType::Offsets, ov::element::u8, true, 300},
+    {EmbeddingBagType::Offsets, ov::element::i8, false, 300},
+    {EmbeddingBagType::Offsets, ov::element::f16, false, 300},
+    {EmbeddingBagType::Packed, ov::element::u8, false, 300},
+    {EmbeddingBagType::Packed, ov::element::f16, false, 16},
+    {EmbeddingBagType::Segments, ov::element::i8, false, 16},
+    {EmbeddingBagType::Segments, ov::element::u8, true, 300},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagCompressed,
+                         EmbeddingBagCompressedTest,
+                         ::testing::ValuesIn(embedding_bag_compressed_params),
+                         EmbeddingBagCompressedTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,203 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/swish.hpp"
+#include "openvino/op/tile.hpp"
+
+/*This test covers the fusion of the Mixture of Experts block exported in the batched form,
+ * where the hidden states are computed by all the experts and weighted by the dense routing tensor.
+ * The fused node computes only the experts which receive tokens: the last expert gets no tokens at all.
+
+      Param [T, H]
+          |
+      Tile [E, 1]
+          |
+    Reshape [E, T, H]
+       /        \
+  MatMul(gate)  MatMul(up)
+      |           |
+    Swish         |
+        \        /
+         Multiply
+            |
+       MatMul(down)   Param(routing) [E, T, 1]
+                  \    /
+                 Multiply
+                    |
+               ReduceSum(0)
+                    |
+                 Result
+*/
+
+namespace ov {
+namespace test {
+
+struct MoEFusionParams {
+    ov::test::InputShape inputShape;
+    size_t experts;
+    size_t hidden_size;
+    size_t intermediate_size;
+    bool quantized;
+    bool broadcast_scales = false;  // the scales are shared by all the experts, the block must not be fused
+};
+
+class MoEFusionTest : public testing::WithParamInterface<MoEFusionParams>, public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<MoEFusionParams>& obj) {
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::partialShape2str({obj.param.inputShape.first}) << "_";
+        result << "TS=";
+        for (const auto& shape : obj.param.inputShape.second) {
+            result << ov::test::utils::vec2str(shape);
+            result << "_";
+        }
+        result << "experts=" << obj.param.experts << "_";
+        result << "intermediate_size=" << obj.param.intermediate_size << "_";
+        result << "quantized=" << obj.param.quantized;
+        if (obj.param.broadcast_scales) {
+            result << "_broadcast_scales";
+        }
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration[ov::hint::inference_precision.name()] = "f32";
+
+        const auto& param = this->GetParam();
+        const auto E = param.experts;
+        const auto H = param.hidden_size;
+        const auto I = param.intermediate_size;
+
+        const auto& tokens = param.inputShape.first[0];
+        const ov::test::InputShape routingShape{ov::PartialShape{static_cast<int64_t>(E), tokens, 1}, {}};
+        auto shapes = std::vector<ov::test::InputShape>{param.inputShape, routingShape};
+        for (const auto& shape : param.inputShape.second) {
+            shapes[1].second.push_back({E, shape[0], 1});
+        }
+        init_input_shapes(shapes);
+
+        auto src = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0]);
+        auto routing = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[1]);
+
+        auto create_const = [&](size_t OC, size_t IC) -> std::shared_ptr<ov::Node> {
+            ov::test::utils::InputGenerateData in_data;
+            if (param.quantized) {
+                in_data.start_from = -64;
+                in_data.range = 127;
+                auto tensor = ov::test::utils::create_and_fill_tensor(ov::element::i8, ov::Shape{E, OC, IC}, in_data);
+                auto weight_f32 =
+                    std::make_shared<ov::op::v0::Convert>(std::make_shared<ov::op::v0::Constant>(tensor),
+                                                          ov::element::f32);
+                in_data.start_from = 0;
+                in_data.range = 1;
+                in_data.resolution = 1024;
+                const auto scalesShape = param.broadcast_scales ? ov::Shape{1, 1, 1} : ov::Shape{E, OC, 1};
+                auto scales = ov::test::utils::create_and_fill_tensor(ov::element::f32, scalesShape, in_data);
+                return std::make_shared<ov::op::v1::Multiply>(weight_f32,
+                                                              std::make_shared<ov::op::v0::Constant>(scales));
+            }
+            in_data.start_from = -0.5;
+            in_data.range = 1;
+            in_data.resolution = 100;
+            auto tensor = ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{E, OC, IC}, in_data);
+            return std::make_shared<ov::op::v0::Constant>(tensor);
+        };
+
+        auto repeats = ov::op::v0::Constant::create(ov::element::i64, {2}, {static_cast<int64_t>(E), 1});
+        auto tiled = std::make_shared<ov::op::v0::Tile>(src, repeats);
+        const std::vector<int64_t> expertDims{static_cast<int64_t>(E), -1, static_cast<int64_t>(H)};
+        auto expertShape = ov::op::v0::Constant::create(ov::element::i64, {3}, expertDims);
+        auto expertInput = std::make_shared<ov::op::v1::Reshape>(tiled, expertShape, false);
+
+        auto gate_proj = std::make_shared<ov::op::v0::MatMul>(expertInput, create_const(I, H), false, true);
+        auto up_proj = std::make_shared<ov::op::v0::MatMul>(expertInput, create_const(I, H), false, true);
+        auto gate_up = std::make_shared<ov::op::v1::Multiply>(std::make_shared<ov::op::v4::Swish>(gate_proj), up_proj);
+        auto down_proj = std::make_shared<ov::op::v0::MatMul>(gate_up, create_const(H, I), false, true);
+
+        auto weighted = std::make_shared<ov::op::v1::Multiply>(down_proj, routing);
+        auto axis = ov::op::v0::Constant::create(ov::element::i64, {1}, {0});
+        auto output = std::make_shared<ov::op::v1::ReduceSum>(weighted, axis, false);
+
+        function = std::make_shared<ov::Model>(ov::OutputVector{output}, ov::ParameterVector{src, routing});
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& params = function->get_parameters();
+
+        ov::test::utils::InputGenerateData in_data;
+        in_data.start_from = -1;
+        in_data.range = 2;
+        in_data.resolution = 128;
+        inputs[params[0]] =
+            ov::test::utils::create_and_fill_tensor(ov::element::f32, targetInputStaticShapes[0], in_data);
+
+        // top-2 routing over all the experts but the last one
+        const auto& routingShape = targetInputStaticShapes[1];
+        const auto E = routingShape[0];
+        const auto T = routingShape[1];
+        ov::Tensor routing(ov::element::f32, routingShape);
+        auto* data = routing.data<float>();
+        std::fill_n(data, routing.get_size(), 0.F);
+        for (size_t t = 0; t < T; t++) {
+            data[(t % (E - 1)) * T + t] = 0.75F;
+            data[((t + 1) % (E - 1)) * T + t] = 0.25F;
+        }
+        inputs[params[1]] = routing;
+    }
+
+    void check_results() {
+        auto exec_model = compiledModel.get_runtime_model();
+
+        const bool fused = !GetParam().broadcast_scales;
+        int fused_node_found = 0;
+        for (const auto& n : exec_model->get_ordered_ops()) {
+            auto layer_type = n->get_rt_info().at(ov::exec_model_info::LAYER_TYPE).as<std::string>();
+            if (layer_type == "MoE")
+                fused_node_found++;
+            if (fused)
+                ASSERT_NE(layer_type, "MatMul");
+        }
+        ASSERT_EQ(fused_node_found, fused ? 1 : 0);
+    }
+};
+
+TEST_P(MoEFusionTest, CompareWithRefs) {
+    run();
+    check_results();
+}
+
+namespace {
+
+// the decoding shape routes a single token, the prefill ones route several tokens to every expert
+static ov::test::InputShape ishape{ov::PartialShape{-1, 64}, {ov::Shape{1, 64}, ov::Shape{5, 64}, ov::Shape{67, 64}}};
+
+const std::vector<MoEFusionParams> moe_params = {
+    {ishape, 4, 64, 96, false},
+    {ishape, 8, 64, 96, false},
+    {ishape, 4, 64, 96, true},
+    {ishape, 4, 64, 96, true, true},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MoEFusion,
+                         MoEFusionTest,
+                         ::testing::ValuesIn(moe_params),
+                         MoEFusionTest::getTestCaseName);
+}  // namespace
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,145 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "common_test_utils/test_common.hpp"
+#include "nodes/kernels/x64/dyn_quant_gemm.hpp"
+
+namespace dynQuantGemmUnitTest {
+
+struct DynQuantGemmParams {
+    size_t M;
+    size_t N;
+    size_t K;
+    size_t group;
+    size_t block;
+};
+
+class DynQuantGemmTest : public ov::test::TestsCommon, public testing::WithParamInterface<DynQuantGemmParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<DynQuantGemmParams>& obj) {
+        const auto& p = obj.param;
+        std::ostringstream result;
+        result << "M=" << p.M << "_N=" << p.N << "_K=" << p.K << "_group=" << p.group << "_block=" << p.block;
+        return result.str();
+    }
+};
+
+TEST_P(DynQuantGemmTest, compareWithDecompressedWeights) {
+    const auto [M, N, K, group, block] = GetParam();
+    const size_t groups = K / group;
+    const size_t blocks = K / block;
+    const size_t NB = (N + 7) / 8;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    std::uniform_int_distribution<int> u4(0, 15);
+
+    std::vector<float> src(M * K);
+    std::vector<int> weights(N * K);
+    std::vector<float> scales(N * groups);
+    std::vector<int> zp(N * groups);
+    std::vector<float> bias(N);
+    for (auto& v : src)
+        v = dist(gen);
+    for (auto& v : weights)
+        v = u4(gen);
+    for (auto& v : scales)
+        v = dist(gen) * 0.1f;
+    for (auto& v : zp)
+        v = u4(gen);
+    for (auto& v : bias)
+        v = dist(gen);
+
+    // the layout expected by dq_fc_gemm
+    std::vector<uint8_t> packed(NB * K * 4, 0);
+    std::vector<float> packedScales(NB * groups * 8, 0.f);
+    std::vector<int32_t> packedZp(NB * groups * 8, 0);
+    std::vector<int32_t> packedComp(NB * blocks * 8, 0);
+    for (size_t n = 0; n < N; n++) {
+        const size_t nb = n / 8;
+        const size_t lane = n % 8;
+        for (size_t k = 0; k < K; k++) {
+            const auto w = static_cast<uint8_t>(weights[n * K + k]);
+            packed[nb * K * 4 + (k / 8) * 32 + lane * 4 + k % 4] |= (k % 8) < 4 ? w : static_cast<uint8_t>(w << 4);
+            packedComp[(nb * blocks + k / block) * 8 + lane] += 128 * w;
+        }
+        for (size_t g = 0; g < groups; g++) {
+            packedScales[(nb * groups + g) * 8 + lane] = scales[n * groups + g];
+            packedZp[(nb * groups + g) * 8 + lane] = zp[n * groups + g];
+        }
+    }
+
+    std::vector<uint8_t> qsrc(M * K);
+    std::vector<float> srcScales(M * blocks);
+    std::vector<int32_t> srcSums(M * blocks);
+    ov::Extensions::Cpu::XARCH::dq_fc_quantize_src(src.data(),
+                                                   K,
+                                                   qsrc.data(),
+                                                   K,
+                                                   M,
+                                                   K,
+                                                   block,
+                                                   srcScales.data(),
+                                                   srcSums.data());
+
+    // the output channels are computed by two calls to check the partial ranges
+    std::vector<float> dst(M * N, 0.f);
+    const size_t nSplit = std::min(N, size_t{16});
+    for (const auto& [nBegin, nEnd] : {std::make_pair(size_t{0}, nSplit), std::make_pair(nSplit, N)}) {
+        ov::Extensions::Cpu::XARCH::dq_fc_gemm(qsrc.data(),
+                                               K,
+                                               srcScales.data(),
+                                               srcSums.data(),
+                                               M,
+                                               packed.data(),
+                                               packedScales.data(),
+                                               packedZp.data(),
+                                               packedComp.data(),
+                                               K,
+                                               block,
+                                               group,
+                                               nBegin,
+                                               nEnd,
+                                               bias.data(),
+                                               dst.data(),
+                                               N);
+    }
+
+    for (size_t m = 0; m < M; m++) {
+        // the rounding error of the int8 activations is at most a half of the block scale
+        std::vector<double> srcError(blocks, 0.0);
+        for (size_t k = 0; k < K; k++) {
+            srcError[k / block] = std::max(srcError[k / block], std::fabs(src[m * K + k]) / 254.0);
+        }
+        for (size_t n = 0; n < N; n++) {
+            double expected = bias[n];
+            double tolerance = 1e-4;
+            for (size_t k = 0; k < K; k++) {
+                const size_t g = k / group;
+                const double w = (weights[n * K + k] - zp[n * groups + g]) * scales[n * groups + g];
+                expected += src[m * K + k] * w;
+                tolerance += srcError[k / block] * std::fabs(w) * 1.01;
+            }
+            ASSERT_NEAR(dst[m * N + n], expected, tolerance) << "m=" << m << " n=" << n;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(DynQuantGemmUnitTest,
+                         DynQuantGemmTest,
+                         ::testing::Values(DynQuantGemmParams{1, 32, 128, 128, 128},
+                                           DynQuantGemmParams{3, 21, 128, 64, 32},
+                                           DynQuantGemmParams{7, 40, 256, 128, 128},
+                                           DynQuantGemmParams{16, 8, 96, 32, 16}),
+                         DynQuantGemmTest::getTestCaseName);
+
+}  // namespace dynQuantGemmUnitTest
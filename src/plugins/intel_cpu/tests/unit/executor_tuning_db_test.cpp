@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "nodes/executors/executor_tuning_db.hpp"
+
+using namespace ov::intel_cpu;
+
+class ExecutorTuningDbTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path = ov::test::utils::generateTestFilePrefix() + "_executor_tuning.db";
+    }
+
+    void TearDown() override {
+        ov::test::utils::removeFile(path);
+    }
+
+    std::string path;
+};
+
+TEST_F(ExecutorTuningDbTest, StoreAndReload) {
+    {
+        ExecutorTuningDb db(path);
+        ASSERT_FALSE(db.find("fc|f32:1x64").has_value());
+        db.store("fc|f32:1x64", "fullyconnected_mlas");
+        db.store("fc|f32:64x64", "fullyconnected_dnnl");
+        db.store("fc|f32:1x64", "fullyconnected_dnnl");
+        ASSERT_EQ(db.find("fc|f32:1x64"), "fullyconnected_dnnl");
+    }
+
+    // the last entry for the key wins
+    ExecutorTuningDb reloaded(path);
+    ASSERT_EQ(reloaded.find("fc|f32:1x64"), "fullyconnected_dnnl");
+    ASSERT_EQ(reloaded.find("fc|f32:64x64"), "fullyconnected_dnnl");
+}
+
+TEST_F(ExecutorTuningDbTest, SharedBetweenInstances) {
+    ExecutorTuningDb first(path);
+    ExecutorTuningDb second(path);
+
+    // the file is read once, the entry stored by another instance (e.g. another process) is picked up
+    // by the databases created afterwards
+    first.store("conv|f32:1x32x16x16", "convolution_dnnl_nspc_nspc");
+    ASSERT_FALSE(second.find("conv|f32:1x32x16x16").has_value());
+    ExecutorTuningDb third(path);
+    ASSERT_EQ(third.find("conv|f32:1x32x16x16"), "convolution_dnnl_nspc_nspc");
+
+    // the same file shares the same database within the process
+    ASSERT_EQ(ExecutorTuningDb::get(path), ExecutorTuningDb::get(path));
+    ASSERT_EQ(ExecutorTuningDb::get(""), nullptr);
+}
+
+TEST_F(ExecutorTuningDbTest, SkipMalformedEntries) {
+    {
+        std::ofstream file(path);
+        file << "no separator\n";
+        file << "\tno key\n";
+        file << "fc|f32:1x64\tfullyconnected_mlas\n";
+    }
+
+    ExecutorTuningDb db(path);
+    ASSERT_EQ(db.find("fc|f32:1x64"), "fullyconnected_mlas");
+    ASSERT_FALSE(db.find("no separator").has_value());
+}
+
+TEST_F(ExecutorTuningDbTest, KeepEntriesIfFileIsNotWritable) {
+    // the parent directory doesn't exist, so the file can be neither read nor written
+    ExecutorTuningDb db(path + "_missing_dir/executor_tuning.db");
+    ASSERT_NO_THROW(db.store("fc|f32:1x64", "fullyconnected_mlas"));
+    ASSERT_EQ(db.find("fc|f32:1x64"), "fullyconnected_mlas");
+}
@@ -0,0 +1,84 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+
+#include "cpu_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+MemoryPtr makeMemory(const dnnl::engine& eng) {
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{4, 4});
+    return std::make_shared<Memory>(eng, desc);
+}
+}  // namespace
+
+TEST(WeightsSharingTest, CreateDifferentKeysConcurrently) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    WeightsSharing cache;
+
+    std::promise<void> slowCreateStarted;
+    std::promise<void> releaseSlowCreate;
+    auto release = releaseSlowCreate.get_future().share();
+
+    // the slow creation of the first entry must not block the creation of another one
+    std::thread slow([&] {
+        MemoryPtr memory = *cache.findOrCreate("slow", [&] {
+            slowCreateStarted.set_value();
+            release.wait();
+            return makeMemory(eng);
+        });
+        ASSERT_NE(memory, nullptr);
+    });
+
+    slowCreateStarted.get_future().wait();
+    MemoryPtr fast = *cache.findOrCreate("fast", [&] {
+        return makeMemory(eng);
+    });
+    ASSERT_NE(fast, nullptr);
+
+    releaseSlowCreate.set_value();
+    slow.join();
+}
+
+TEST(WeightsSharingTest, CreateSameKeyOnce) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    WeightsSharing cache;
+
+    std::atomic<int> createCount{0};
+    auto create = [&] {
+        createCount++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        return makeMemory(eng);
+    };
+
+    MemoryPtr memory1;
+    MemoryPtr memory2;
+    std::thread worker1([&] {
+        memory1 = *cache.findOrCreate("key", create);
+    });
+    std::thread worker2([&] {
+        memory2 = *cache.findOrCreate("key", create);
+    });
+    worker1.join();
+    worker2.join();
+
+    ASSERT_EQ(createCount, 1);
+    ASSERT_EQ(memory1, memory2);
+
+    // the entry is recreated once the memory is released by all the users
+    memory1.reset();
+    memory2.reset();
+    MemoryPtr memory3 = *cache.findOrCreate("key", create);
+    ASSERT_EQ(createCount, 2);
+    ASSERT_EQ(memory3, *cache.get("key"));
+}
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+import argparse
+import time
+
+import numpy as np
+import openvino as ov
+import openvino.opset13 as ops
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Compare the dynamically quantized and the decompressed "
+                                                 "FullyConnected with int4 weights")
+    parser.add_argument('--ic', type=int, default=4096, help="input channels (K)")
+    parser.add_argument('--oc', type=int, default=4096, help="output channels (N)")
+    parser.add_argument('--weights_group', type=int, default=128, help="weights compression group size")
+    parser.add_argument('--weights_type', choices=['u4', 'i4'], default='u4', help="weights precision")
+    parser.add_argument('--dq_group', type=int, default=32, help="dynamic quantization group size")
+    parser.add_argument('--rows', '-m', type=int, nargs='+', default=[1, 2, 4, 8, 16, 32, 64, 128, 256],
+                        help="numbers of the input rows (M)")
+    parser.add_argument('--iterations', '-n', type=int, default=50, help="number of the measured inferences")
+    parser.add_argument('--threads', type=int, default=0, help="number of the inference threads, 0 - default")
+    return parser.parse_args()
+
+
+def create_model(ic, oc, group, weights_type):
+    rng = np.random.default_rng(0)
+    groups = ic // group
+    src = ops.parameter([-1, ic], ov.Type.f32, name="src")
+
+    if weights_type == 'u4':
+        weights = ops.constant(rng.integers(0, 16, size=(oc, groups, group)).astype(np.uint8), ov.Type.u4)
+        decompressed = ops.subtract(ops.convert(weights, ov.Type.f32),
+                                    ops.convert(ops.constant(np.full((oc, groups, 1), 8, np.uint8), ov.Type.u4),
+                                                ov.Type.f32))
+    else:
+        weights = ops.constant(rng.integers(-8, 8, size=(oc, groups, group)).astype(np.int8), ov.Type.i4)
+        decompressed = ops.convert(weights, ov.Type.f32)
+
+    scales = ops.constant(rng.uniform(0.001, 0.01, size=(oc, groups, 1)).astype(np.float32))
+    decompressed = ops.reshape(ops.multiply(decompressed, scales), [oc, ic], special_zero=False)
+    fc = ops.matmul(src, decompressed, transpose_a=False, transpose_b=True)
+    return ov.Model([fc], [src], "dyn_quant_fc")
+
+
+def benchmark(compiled_model, rows, ic, iterations):
+    request = compiled_model.create_infer_request()
+    src = np.random.default_rng(1).uniform(-1, 1, size=(rows, ic)).astype(np.float32)
+    # warm up, the executor is prepared for the new shape
+    for _ in range(3):
+        request.infer([src])
+    start = time.perf_counter()
+    for _ in range(iterations):
+        request.infer([src])
+    latency = (time.perf_counter() - start) / iterations * 1000
+    return latency, [info.exec_type for info in request.profiling_info if info.node_type == "FullyConnected"]
+
+
+if __name__ == "__main__":
+    args = parse_args()
+    core = ov.Core()
+    model = create_model(args.ic, args.oc, args.weights_group, args.weights_type)
+
+    configs = {"decompression": 0, "dyn_quant": args.dq_group}
+    compiled = {}
+    for name, dq_group in configs.items():
+        config = {"INFERENCE_PRECISION_HINT": "f32", "DYNAMIC_QUANTIZATION_GROUP_SIZE": str(dq_group),
+                  "PERF_COUNT": "YES"}
+        if args.threads:
+            config["INFERENCE_NUM_THREADS"] = str(args.threads)
+        compiled[name] = core.compile_model(model, "CPU", config)
+
+    print(f"K={args.ic} N={args.oc} weights={args.weights_type}/{args.weights_group} "
+          f"dq_group={args.dq_group}")
+    print(f"{'M':>5} | {'decompression (ms)':>18} | {'dyn_quant (ms)':>14} | {'speedup':>7} | dyn_quant impl")
+    for rows in args.rows:
+        ref_latency, _ = benchmark(compiled["decompression"], rows, args.ic, args.iterations)
+        dq_latency, dq_impl = benchmark(compiled["dyn_quant"], rows, args.ic, args.iterations)
+        print(f"{rows:>5} | {ref_latency:>18.3f} | {dq_latency:>14.3f} | {ref_latency / dq_latency:>7.2f} | "
+              f"{','.join(dq_impl)}")
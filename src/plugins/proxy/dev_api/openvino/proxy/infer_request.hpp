@@ -45,6 +45,8 @@ public:
 
     std::vector<ov::SoPtr<ov::IVariableState>> query_state() const override;
 
+    void set_required_outputs(const std::vector<ov::Output<const ov::Node>>& ports) override;
+
     const std::shared_ptr<const ov::ICompiledModel>& get_compiled_model() const override;
 
     const std::vector<ov::Output<const ov::Node>>& get_inputs() const override;
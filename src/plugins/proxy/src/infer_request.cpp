@@ -96,6 +96,10 @@ std::vector<ov::SoPtr<ov::IVariableState>> ov::proxy::InferRequest::query_state(
     return states;
 }
 
+void ov::proxy::InferRequest::set_required_outputs(const std::vector<ov::Output<const ov::Node>>& ports) {
+    m_infer_request->set_required_outputs(ports);
+}
+
 const std::shared_ptr<const ov::ICompiledModel>& ov::proxy::InferRequest::get_compiled_model() const {
     return m_compiled_model;
 }
@@ -252,6 +252,50 @@ TEST_P(OVInferRequestBatchedTests, SetInputTensors_Multiple_Infer) {
     }
 }
 
+// Samples laid out back to back in one buffer may be used by the plugin without copying,
+// switching to samples from scattered memory must still produce correct results
+TEST_P(OVInferRequestBatchedTests, SetInputTensors_Contiguous_Then_Scattered) {
+    size_t batch = 4;
+    auto one_shape = Shape{1, 2, 2, 2};
+    auto batch_shape = Shape{batch, 2, 2, 2};
+    auto one_shape_size = ov::shape_size(one_shape);
+    auto model = OVInferRequestBatchedTests::create_n_inputs(1, element::f32, batch_shape, "N...");
+    std::vector<float> contiguous_buffer(one_shape_size * batch, 0);
+    std::vector<float> scattered_buffer(one_shape_size * batch * 2, 0);
+    auto execNet = ie->compile_model(model, target_device);
+    ov::InferRequest req;
+    req = execNet.create_infer_request();
+
+    std::vector<ov::Tensor> contiguous_tensors;
+    std::vector<ov::Tensor> scattered_tensors;
+    for (size_t i = 0; i < batch; ++i) {
+        contiguous_tensors.emplace_back(element::f32, one_shape, &contiguous_buffer[i * one_shape_size]);
+        scattered_tensors.emplace_back(element::f32, one_shape, &scattered_buffer[(i * 2) * one_shape_size]);
+    }
+
+    for (auto testNum = 0; testNum < 4; testNum++) {
+        const auto& tensors = testNum % 2 ? scattered_tensors : contiguous_tensors;
+        req.set_tensors("tensor_input0", tensors);
+        for (size_t i = 0; i < batch; ++i) {
+            auto* f = tensors[i].data<float>();
+            for (size_t j = 0; j < one_shape_size; ++j) {
+                f[j] = static_cast<float>(testNum * 10 + i);
+            }
+        }
+        req.infer();  // Adds '1' to each element
+        auto actual_tensor = req.get_tensor("tensor_output0");
+        auto* actual = actual_tensor.data<float>();
+        for (size_t i = 0; i < batch; ++i) {
+            for (size_t j = 0; j < one_shape_size; ++j) {
+                const auto expected = static_cast<float>(testNum * 10 + i + 1);
+                EXPECT_EQ(actual[i * one_shape_size + j], expected)
+                    << "Infer " << testNum << ": Expected=" << expected << ", actual=" << actual[i * one_shape_size + j]
+                    << " for sample " << i;
+            }
+        }
+    }
+}
+
 TEST_P(OVInferRequestBatchedTests, SetInputTensors_Can_Infer_Dynamic) {
     size_t batch = 4;
     auto one_shape = Shape{1, 2, 2, 2};